@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include "EmbedATK/EmbedATK.h"
+
+// objects owned by a pool, the containers only link them
+struct Job
+{
+    uint32_t id;
+    uint64_t deadline;
+    IntrusiveListHook<Job> listHook;
+    IntrusiveHeapHook<Job> heapHook;
+    IntrusiveHashHook<Job> hashHook;
+
+    bool operator<(const Job& other) const { return deadline < other.deadline; }
+};
+
+constexpr size_t JOBS = 256;
+using JobPool = StaticBlockPool<JOBS, allocData<Job>()>;
+
+static std::array<Job*, JOBS> makeJobs(JobPool& pool)
+{
+    std::array<Job*, JOBS> jobs;
+    for (uint32_t i = 0; i < JOBS; ++i) {
+        // deadlines out of order, as timers are armed
+        jobs[i] = pool.construct<Job>(Job{ .id = 0x1000 + i * 0x10, .deadline = (i * 97) % JOBS, .listHook = {}, .heapHook = {}, .hashHook = {} });
+    }
+    return jobs;
+}
+
+// --- Queue: push all, pop all ---
+
+// node based list allocating from a block pool, as the Static Std containers do
+static void BM_Queue_PmrList(benchmark::State& state)
+{
+    struct ListNode { void* ptrs[2]; Job* value; };
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    auto nodePool = std::make_unique<StaticBlockPool<JOBS, allocData<ListNode>()>>();
+    std::pmr::list<Job*> queue(nodePool.get());
+
+    for (auto _ : state) {
+        for (Job* job : jobs) queue.push_back(job);
+        while (!queue.empty()) {
+            benchmark::DoNotOptimize(queue.front());
+            queue.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Queue_PmrList);
+
+static void BM_Queue_StaticStdQueue(benchmark::State& state)
+{
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    auto queue = std::make_unique<StaticStdQueue<Job*, JOBS>>();
+
+    for (auto _ : state) {
+        for (Job* job : jobs) queue->push(job);
+        while (auto job = queue->pop()) benchmark::DoNotOptimize(*job);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Queue_StaticStdQueue);
+
+static void BM_Queue_IntrusiveList(benchmark::State& state)
+{
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    IntrusiveList<Job, &Job::listHook> queue;
+
+    for (auto _ : state) {
+        for (Job* job : jobs) queue.push_back(*job);
+        while (Job* job = queue.pop_front()) benchmark::DoNotOptimize(job);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Queue_IntrusiveList);
+
+// --- Timers: arm all, expire in deadline order ---
+
+static void BM_Timers_StaticStdMap(benchmark::State& state)
+{
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    auto timers = std::make_unique<StaticStdMap<uint64_t, Job*, JOBS>>();
+
+    for (auto _ : state) {
+        for (Job* job : jobs) timers->insert({ job->deadline, job });
+        while (!timers->empty()) {
+            const auto next = timers->begin();
+            benchmark::DoNotOptimize(next->second);
+            timers->erase(next->first);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Timers_StaticStdMap);
+
+static void BM_Timers_IntrusivePairingHeap(benchmark::State& state)
+{
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    IntrusivePairingHeap<Job, &Job::heapHook> timers;
+
+    for (auto _ : state) {
+        for (Job* job : jobs) timers.push(*job);
+        while (Job* job = timers.pop()) benchmark::DoNotOptimize(job);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Timers_IntrusivePairingHeap);
+
+// --- Lookup table: insert all, erase all by key ---
+
+static void BM_Table_StaticStdMap(benchmark::State& state)
+{
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    auto table = std::make_unique<StaticStdMap<uint32_t, Job*, JOBS>>();
+
+    for (auto _ : state) {
+        for (Job* job : jobs) table->insert({ job->id, job });
+        for (Job* job : jobs) table->erase(job->id);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Table_StaticStdMap);
+
+static void BM_Table_IntrusiveHashTable(benchmark::State& state)
+{
+    auto pool = std::make_unique<JobPool>();
+    const auto jobs = makeJobs(*pool);
+    IntrusiveHashTable<Job, &Job::hashHook, &Job::id, JOBS> table;
+
+    for (auto _ : state) {
+        for (Job* job : jobs) table.insert(*job);
+        for (Job* job : jobs) benchmark::DoNotOptimize(table.erase(job->id));
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS);
+}
+BENCHMARK(BM_Table_IntrusiveHashTable);
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include "EmbedATK/EmbedATK.h"
+
+// object dictionary like keys: sparse 16 bit indices
+static constexpr uint32_t mapKey(size_t i)
+{
+    return 0x1000 + static_cast<uint32_t>(i) * 0x10;
+}
+
+template<typename Map>
+static void fillMap(Map& map, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        map[mapKey(i)] = static_cast<uint32_t>(i);
+    }
+}
+
+// --- Lookup ---
+
+template<typename Map, size_t N>
+static void BM_Map_Lookup(benchmark::State& state)
+{
+    auto map = std::make_unique<Map>();
+    fillMap(*map, N);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map->at(mapKey(i)));
+        i = (i + 7) % N;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Map_Lookup<StaticStdMap<uint32_t, uint32_t, 8>, 8>);
+BENCHMARK(BM_Map_Lookup<StaticSortedMap<uint32_t, uint32_t, 8>, 8>);
+BENCHMARK(BM_Map_Lookup<StaticFlatMap<uint32_t, uint32_t, 8>, 8>);
+BENCHMARK(BM_Map_Lookup<StaticStdMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_Lookup<StaticSortedMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_Lookup<StaticFlatMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_Lookup<StaticStdMap<uint32_t, uint32_t, 1024>, 1024>);
+BENCHMARK(BM_Map_Lookup<StaticSortedMap<uint32_t, uint32_t, 1024>, 1024>);
+BENCHMARK(BM_Map_Lookup<StaticFlatMap<uint32_t, uint32_t, 1024>, 1024>);
+
+template<size_t N>
+static constexpr auto constexprMapEntries()
+{
+    std::array<std::pair<uint32_t, uint32_t>, N> entries{};
+    for (size_t i = 0; i < N; ++i) {
+        entries[i] = { mapKey(i), static_cast<uint32_t>(i) };
+    }
+    return entries;
+}
+
+// keys known at compile time, the table is placed in read-only memory
+template<size_t N>
+static void BM_ConstexprMap_Lookup(benchmark::State& state)
+{
+    static constexpr ConstexprMap<uint32_t, uint32_t, N> map(constexprMapEntries<N>());
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.at(mapKey(i)));
+        i = (i + 7) % N;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConstexprMap_Lookup<8>);
+BENCHMARK(BM_ConstexprMap_Lookup<64>);
+BENCHMARK(BM_ConstexprMap_Lookup<1024>);
+
+// misses end the probe early in the flat map and at a leaf in the tree
+template<typename Map, size_t N>
+static void BM_Map_LookupMiss(benchmark::State& state)
+{
+    auto map = std::make_unique<Map>();
+    fillMap(*map, N);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map->contains(mapKey(i) + 1));
+        i = (i + 7) % N;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Map_LookupMiss<StaticStdMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_LookupMiss<StaticSortedMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_LookupMiss<StaticFlatMap<uint32_t, uint32_t, 64>, 64>);
+
+// --- Insert/Erase ---
+
+template<typename Map, size_t N>
+static void BM_Map_InsertErase(benchmark::State& state)
+{
+    auto map = std::make_unique<Map>();
+    fillMap(*map, N - 1);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        // replace one entry per iteration, the map stays at N-1 entries
+        map->erase(mapKey(i));
+        map->insert({mapKey(i), static_cast<uint32_t>(i)});
+        i = (i + 7) % (N - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Map_InsertErase<StaticStdMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_InsertErase<StaticSortedMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_InsertErase<StaticFlatMap<uint32_t, uint32_t, 64>, 64>);
+
+// --- Iteration ---
+
+template<typename Map, size_t N>
+static void BM_Map_Iterate(benchmark::State& state)
+{
+    auto map = std::make_unique<Map>();
+    fillMap(*map, N);
+
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (const auto& [key, value] : *map) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(BM_Map_Iterate<StaticStdMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_Iterate<StaticSortedMap<uint32_t, uint32_t, 64>, 64>);
+BENCHMARK(BM_Map_Iterate<StaticFlatMap<uint32_t, uint32_t, 64>, 64>);
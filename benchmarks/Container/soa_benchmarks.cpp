@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include "EmbedATK/EmbedATK.h"
+
+// process data of one drive axis, cyclic loops usually touch one or two members of all axes
+struct Axis
+{
+    uint32_t statusWord;
+    uint32_t controlWord;
+    double actualPosition;
+    double targetPosition;
+    double actualVelocity;
+    double actualTorque;
+    std::array<uint8_t, 16> diagnostics;
+};
+
+constexpr uint32_t FAULT_BIT = 0x08;
+constexpr double CYCLE_TIME = 0.001;
+
+using AoSAxes = StaticVector<Axis, 4096>;
+using SoAAxes = StaticSoAVector<Axis, 4096>;
+
+template<typename Axes>
+static std::unique_ptr<Axes> makeAxes(const size_t count)
+{
+    auto axes = std::make_unique<Axes>();
+    for (size_t i = 0; i < count; ++i) {
+        axes->push_back(Axis{ i % 7 == 0 ? FAULT_BIT : 0x27, 0x0F, i * 0.5, i * 0.5 + 1.0, 1.0, 0.1, {} });
+    }
+    return axes;
+}
+
+// --- Single member ---
+
+static void BM_AoS_CountFaults(benchmark::State& state)
+{
+    const auto axes = makeAxes<AoSAxes>(state.range(0));
+    for (auto _ : state) {
+        uint32_t faults = 0;
+        for (const auto& axis : axes->fast()) faults += (axis.statusWord & FAULT_BIT) != 0;
+        benchmark::DoNotOptimize(faults);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AoS_CountFaults)->Arg(64)->Arg(512)->Arg(4096);
+
+static void BM_SoA_CountFaults(benchmark::State& state)
+{
+    const auto axes = makeAxes<SoAAxes>(state.range(0));
+    for (auto _ : state) {
+        uint32_t faults = 0;
+        for (const uint32_t status : axes->column<SoAAxes::field("statusWord")>()) faults += (status & FAULT_BIT) != 0;
+        benchmark::DoNotOptimize(faults);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SoA_CountFaults)->Arg(64)->Arg(512)->Arg(4096);
+
+// --- Two members ---
+
+static void BM_AoS_Integrate(benchmark::State& state)
+{
+    const auto axes = makeAxes<AoSAxes>(state.range(0));
+    for (auto _ : state) {
+        for (auto& axis : axes->fast()) axis.actualPosition += axis.actualVelocity * CYCLE_TIME;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AoS_Integrate)->Arg(64)->Arg(512)->Arg(4096);
+
+static void BM_SoA_Integrate(benchmark::State& state)
+{
+    const auto axes = makeAxes<SoAAxes>(state.range(0));
+    for (auto _ : state) {
+        const auto position = axes->column<SoAAxes::field("actualPosition")>();
+        const auto velocity = axes->column<SoAAxes::field("actualVelocity")>();
+        for (size_t i = 0; i < position.size(); ++i) position[i] += velocity[i] * CYCLE_TIME;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SoA_Integrate)->Arg(64)->Arg(512)->Arg(4096);
+
+// --- Whole elements ---
+
+// proxies gather a member per element, the cost of treating the columns as rows
+static void BM_SoA_ProxyIterate(benchmark::State& state)
+{
+    const auto axes = makeAxes<SoAAxes>(state.range(0));
+    for (auto _ : state) {
+        uint32_t faults = 0;
+        for (const auto axis : *axes) faults += (axis.get<0>() & FAULT_BIT) != 0;
+        benchmark::DoNotOptimize(faults);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SoA_ProxyIterate)->Arg(64)->Arg(512)->Arg(4096);
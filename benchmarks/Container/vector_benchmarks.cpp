@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include "EmbedATK/EmbedATK.h"
+
+// a record as it is batched between threads
+struct Message
+{
+    uint32_t id;
+    uint32_t size;
+    std::array<uint8_t, 24> payload;
+};
+
+constexpr size_t INLINE_MESSAGES = 16;
+constexpr size_t MAX_MESSAGES = 256;
+
+// --- Batch: fill with state.range(0) messages, sum, clear ---
+// 8 is the usual batch, 200 a burst beyond the inline capacity
+
+static void fillAndSum(IVector<Message>& batch, benchmark::State& state)
+{
+    const auto count = static_cast<uint32_t>(state.range(0));
+    for (uint32_t i = 0; i < count; ++i) {
+        batch.push_back(Message{ .id = i, .size = i & 0xFF, .payload = {} });
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        sum += batch[i].size;
+    }
+    benchmark::DoNotOptimize(sum);
+    batch.clear();
+}
+
+static void BM_Batch_StdVector(benchmark::State& state)
+{
+    const auto count = static_cast<uint32_t>(state.range(0));
+    for (auto _ : state) {
+        std::vector<Message> batch;
+        for (uint32_t i = 0; i < count; ++i) {
+            batch.push_back(Message{ .id = i, .size = i & 0xFF, .payload = {} });
+        }
+        uint64_t sum = 0;
+        for (const auto& message : batch) {
+            sum += message.size;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Batch_StdVector)->Arg(8)->Arg(200);
+
+// sized for the worst case, every batch goes through the PMR resource
+static void BM_Batch_StaticStdVector(benchmark::State& state)
+{
+    for (auto _ : state) {
+        StaticStdVector<Message, MAX_MESSAGES> batch;
+        fillAndSum(batch, state);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Batch_StaticStdVector)->Arg(8)->Arg(200);
+
+// the arena is reset after each batch, as a per-batch pool would be
+static void BM_Batch_HybridVector(benchmark::State& state)
+{
+    auto pool = std::make_unique<StaticMonotonicPool<Message, 2 * MAX_MESSAGES>>();
+    for (auto _ : state) {
+        HybridVector<Message, INLINE_MESSAGES> batch(*pool);
+        fillAndSum(batch, state);
+        batch.shrink_to_fit();
+        pool->release();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Batch_HybridVector)->Arg(8)->Arg(200);
@@ -0,0 +1,211 @@
+#include <benchmark/benchmark.h>
+
+#include "EmbedATK/EmbedATK.h"
+
+// Captures records like the real logger but keeps only the last one,
+// so only the producer side of a log call is measured.
+class CaptureLogger : public ILogger
+{
+public:
+    const LogData& last() const { return m_last; }
+
+private:
+    void addMessage(LogData&& data) override
+    {
+        m_last = data;
+        benchmark::DoNotOptimize(m_last);
+    }
+
+    LogData m_last{};
+};
+
+// --- Producer ---
+
+// what every call did before records were binary: formatting on the caller's thread
+static void BM_Producer_EagerStrings(benchmark::State& state)
+{
+    int i = 0;
+    for (auto _ : state) {
+        auto message = std::format("value {} scaled {} flag {}", i, i * 0.5, i % 2 == 0);
+        benchmark::DoNotOptimize(message);
+        ++i;
+    }
+}
+BENCHMARK(BM_Producer_EagerStrings);
+
+static void BM_Producer_Binary(benchmark::State& state)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    CaptureLogger logger;
+    int i = 0;
+    for (auto _ : state) {
+        logger.log(site, true, "value {} scaled {} flag {}", i, i * 0.5, i % 2 == 0);
+        ++i;
+    }
+}
+BENCHMARK(BM_Producer_Binary);
+
+static void BM_Producer_BinaryText(benchmark::State& state)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    CaptureLogger logger;
+    const std::string name = "adapter0";
+    int i = 0;
+    for (auto _ : state) {
+        logger.log(site, true, "{} value {}", name, i);
+        ++i;
+    }
+}
+BENCHMARK(BM_Producer_BinaryText);
+
+// runtime-disabled site, only the cached level check runs
+static void BM_Producer_DisabledSite(benchmark::State& state)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Trace);
+    static constinit LogSiteLevel siteLevel;
+    CaptureLogger logger;
+    logger.setLevel(LogLevel::Info);
+    int i = 0;
+    for (auto _ : state) {
+        if (logger.enabled(site, siteLevel))
+            logger.log(site, true, "value {}", i);
+        ++i;
+    }
+}
+BENCHMARK(BM_Producer_DisabledSite);
+
+// --- Consumer ---
+
+static void BM_Consumer_Format(benchmark::State& state)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    CaptureLogger logger;
+    logger.log(site, true, "value {} scaled {} flag {}", 42, 21.0, true);
+
+    std::string message;
+    for (auto _ : state) {
+        message.clear();
+        ILogger::formatMessage(message, logger.last());
+        benchmark::DoNotOptimize(message);
+    }
+}
+BENCHMARK(BM_Consumer_Format);
+
+// --- Drain ---
+
+constexpr size_t DRAIN_QUEUE_SIZE = 1024;
+using DrainQueue = Utils::StaticTypedMessageQueue<ILogger::LogData, DRAIN_QUEUE_SIZE>;
+
+static void fillDrainQueue(DrainQueue& queue)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    ILogger::LogData data{};
+    data.site = &site;
+    for (size_t i = 0; i < DRAIN_QUEUE_SIZE; ++i) {
+        data.size = i;
+        queue.queue.push(data);
+    }
+}
+
+// records are read in place in the ring
+template<size_t BatchSize>
+static void BM_Drain_View(benchmark::State& state)
+{
+    auto queue = std::make_unique<DrainQueue>();
+    Utils::setupStaticMessageQueue(*queue);
+
+    for (auto _ : state) {
+        fillDrainQueue(*queue);
+        size_t sum = 0;
+        while (true) {
+            const auto view = queue->queue.drain(BatchSize);
+            if (view.empty()) break;
+            for (const auto& data : view) sum += data.size;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * DRAIN_QUEUE_SIZE);
+}
+BENCHMARK(BM_Drain_View<1>);
+BENCHMARK(BM_Drain_View<8>);
+BENCHMARK(BM_Drain_View<32>);
+BENCHMARK(BM_Drain_View<128>);
+
+// records are moved into a local queue first, as popAvail does
+template<size_t BatchSize>
+static void BM_Drain_PopAvail(benchmark::State& state)
+{
+    auto queue = std::make_unique<DrainQueue>();
+    Utils::setupStaticMessageQueue(*queue);
+    StaticQueue<ILogger::LogData, BatchSize> local;
+
+    for (auto _ : state) {
+        fillDrainQueue(*queue);
+        size_t sum = 0;
+        while (Utils::tryPopAvailStaticMessageQueue(*queue, local)) {
+            for (const auto& data : local.fast()) sum += data.size;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * DRAIN_QUEUE_SIZE);
+}
+BENCHMARK(BM_Drain_PopAvail<1>);
+BENCHMARK(BM_Drain_PopAvail<8>);
+BENCHMARK(BM_Drain_PopAvail<32>);
+BENCHMARK(BM_Drain_PopAvail<128>);
+
+// --- Logger throughput ---
+
+class CountingSink : public ILogSink
+{
+public:
+    void write(const LogBatch& batch) override
+    {
+        m_batches.fetch_add(1, std::memory_order_relaxed);
+        m_records.fetch_add(batch.records.size(), std::memory_order_release);
+    }
+
+    size_t records() const { return m_records.load(std::memory_order_acquire); }
+    size_t batches() const { return m_batches.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic_size_t m_records = 0;
+    std::atomic_size_t m_batches = 0;
+};
+
+// end to end: producer, logging thread rendering the batches, and a sink
+template<size_t BatchSize>
+static void BM_Logger_Throughput(benchmark::State& state)
+{
+    using BenchLogger = Logger<1024, 64*1024, BatchSize>;
+    constexpr size_t MESSAGES = 4096;
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+
+    auto logger = std::make_unique<BenchLogger>(0);
+    CountingSink sink;
+    logger->removeSink(logger->console());
+    logger->addSink(sink);
+    logger->setOverflowPolicy(LogOverflowPolicy::Block, 1000*1000);
+    g_logger = logger.get();
+    logger->start();
+
+    size_t expected = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < MESSAGES; ++i) {
+            logger->log(site, true, "value {} of {}", i, MESSAGES);
+        }
+        expected += MESSAGES;
+        while (sink.records() < expected) {
+            OSAL::sleep(10);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * MESSAGES);
+    state.counters["records/batch"] = static_cast<double>(sink.records()) / std::max<size_t>(sink.batches(), 1);
+
+    logger.reset();
+    g_logger = nullptr;
+}
+BENCHMARK(BM_Logger_Throughput<1>)->UseRealTime();
+BENCHMARK(BM_Logger_Throughput<8>)->UseRealTime();
+BENCHMARK(BM_Logger_Throughput<32>)->UseRealTime();
+BENCHMARK(BM_Logger_Throughput<128>)->UseRealTime();
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include "EmbedATK/EmbedATK.h"
+
+// protocol timeouts of a busy master: state.range(0) timers, deadlines spread over 1..1000 cycles
+constexpr uint64_t SPREAD = 1000;
+
+static uint64_t deadline(const size_t i) { return 1 + (i * 7919) % SPREAD; }
+
+// --- Cycle: one cycle of checking all timers, expired ones are restarted ---
+
+// every object polls its own deadline, one clock read per timer
+static void BM_Cycle_OSALTimerPolling(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<OSAL::StaticImpl::Timer> timers(count);
+    for (size_t i = 0; i < count; ++i) {
+        OSAL::createTimer(timers[i]);
+        timers[i].get()->start(deadline(i));
+    }
+
+    for (auto _ : state) {
+        size_t expired = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (timers[i].get()->isExpired()) {
+                timers[i].get()->start(deadline(i));
+                expired++;
+            }
+        }
+        benchmark::DoNotOptimize(expired);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Cycle_OSALTimerPolling)->Arg(100)->Arg(1000)->Arg(10000);
+
+// the wheel is advanced by one tick per cycle, only the timers due on it are touched
+static void BM_Cycle_TimerWheel(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    auto wheel = std::make_unique<Utils::StaticTimerWheel<>>();
+    std::vector<Utils::WheelTimer> timers(count);
+    for (size_t i = 0; i < count; ++i) {
+        timers[i].setCallback([](Utils::WheelTimer&, Utils::ITimerWheel&) {});
+        wheel->arm(timers[i], deadline(i), deadline(i));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel->advance(1));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Cycle_TimerWheel)->Arg(100)->Arg(1000)->Arg(10000);
+
+// --- Rearm: a timeout restarted on every message, as a watchdog is ---
+
+static void BM_Rearm_TimerWheel(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    auto wheel = std::make_unique<Utils::StaticTimerWheel<>>();
+    std::vector<Utils::WheelTimer> timers(count);
+    for (size_t i = 0; i < count; ++i) {
+        wheel->arm(timers[i], deadline(i));
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        wheel->arm(timers[i], deadline(i + 1));
+        i = i + 1 < count ? i + 1 : 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Rearm_TimerWheel)->Arg(100)->Arg(10000);
+
+static void BM_Rearm_TimerService(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    auto service = std::make_unique<Utils::TimerService<1000>>();
+    std::vector<Utils::WheelTimer> timers(count);
+    for (size_t i = 0; i < count; ++i) {
+        service->arm(timers[i], deadline(i) * 1000);
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        service->arm(timers[i], deadline(i + 1) * 1000);
+        i = i + 1 < count ? i + 1 : 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Rearm_TimerService)->Arg(100)->Arg(10000);
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "Container.h"
+
+//------------------------------------------------------
+//                      Hash
+//------------------------------------------------------
+
+// 64 bit hashes usable in constant evaluation, the upper 32 bits have to be well mixed
+template<typename K>
+struct ConstexprHash;
+
+template<typename K>
+requires (std::is_integral_v<K> || std::is_enum_v<K>)
+struct ConstexprHash<K>
+{
+    constexpr uint64_t operator()(const K& key) const noexcept
+    {
+        uint64_t x;
+        if constexpr (std::is_enum_v<K>)
+            x = static_cast<uint64_t>(std::to_underlying(key));
+        else
+            x = static_cast<uint64_t>(key);
+
+        // fibonacci hashing, the upper bits depend on all bits of the key
+        return x * 0x9E3779B97F4A7C15ull;
+    }
+};
+
+template<>
+struct ConstexprHash<std::string_view>
+{
+    constexpr uint64_t operator()(std::string_view key) const noexcept
+    {
+        // FNV-1a, spread into the upper bits by fibonacci hashing
+        uint64_t x = 0xCBF29CE484222325ull;
+        for (const char c : key) {
+            x ^= static_cast<uint8_t>(c);
+            x *= 0x100000001B3ull;
+        }
+        return x * 0x9E3779B97F4A7C15ull;
+    }
+};
+
+//------------------------------------------------------
+//                    Constexpr Map
+//------------------------------------------------------
+
+// Immutable map over keys known at compile time, built with a minimal perfect hash (PTHash style):
+// keys are split into buckets by their hash and every bucket gets a pilot value that moves all of its
+// keys to free slots. A lookup is one key hash, one pilot load and one key compare, without probing.
+// Construction is consteval, a constexpr instance lives in read-only memory and needs no startup code.
+template<typename K, typename V, size_t N, typename Hash = ConstexprHash<K>>
+class ConstexprMap
+{
+    static_assert(N > 0, "constexpr map needs at least one entry");
+
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using KeyType   = K;
+    using ValueType = V;
+    using Node      = std::pair<KeyType, ValueType>;
+
+    static constexpr size_t BUCKETS     = N / 2 + 1;
+    static constexpr uint32_t MAX_PILOT = 1u << 20;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    consteval ConstexprMap(const std::array<Node, N>& entries)
+        : ConstexprMap(entries, build(entries), std::make_index_sequence<N>{})
+    {}
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    constexpr auto begin() const noexcept { return m_entries.begin(); }
+    constexpr auto end() const noexcept { return m_entries.end(); }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept { return false; }
+    constexpr size_t size() const noexcept { return N; }
+    constexpr bool contains(const KeyType& key) const { return find(key) != nullptr; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    constexpr const ValueType* find(const KeyType& key) const
+    {
+        const uint64_t hash = Hash{}(key);
+        const Node& node = m_entries[slot(hash, m_pilots[bucket(hash)])];
+        return node.first == key ? &node.second : nullptr;
+    }
+
+    constexpr const ValueType& at(const KeyType& key) const
+    {
+        const ValueType* value = find(key);
+        if (!value) throw std::out_of_range("key not found in map");
+        return *value;
+    }
+
+    constexpr const ValueType& operator[](const KeyType& key) const { return at(key); }
+
+private:
+    struct Layout
+    {
+        std::array<uint32_t, BUCKETS> pilots{};
+        std::array<size_t, N> sources{}; // entry index for each slot
+    };
+
+    template<size_t... I>
+    consteval ConstexprMap(const std::array<Node, N>& entries, const Layout& layout, std::index_sequence<I...>)
+        : m_pilots(layout.pilots), m_entries{ entries[layout.sources[I]]... }
+    {}
+
+    static constexpr size_t bucket(const uint64_t hash) noexcept
+    {
+        return static_cast<size_t>(((hash >> 32) * BUCKETS) >> 32);
+    }
+
+    // the multiplication carries the pilot bits up, a plain xor would keep keys with
+    // equal upper bits on the same slot for every pilot
+    static constexpr size_t slot(const uint64_t hash, const uint32_t pilot) noexcept
+    {
+        const uint64_t mixed = ((hash ^ pilot) * 0x9E3779B97F4A7C15ull) >> 32;
+        return static_cast<size_t>((mixed * N) >> 32);
+    }
+
+    static consteval Layout build(const std::array<Node, N>& entries)
+    {
+        std::array<uint64_t, N> hashes{};
+        for (size_t i = 0; i < N; ++i) {
+            hashes[i] = Hash{}(entries[i].first);
+        }
+
+        // entries grouped by bucket: members[offsets[b], offsets[b+1])
+        std::array<size_t, BUCKETS + 1> offsets{};
+        for (const uint64_t hash : hashes) {
+            offsets[bucket(hash) + 1]++;
+        }
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            offsets[b + 1] += offsets[b];
+        }
+        std::array<size_t, N> members{};
+        std::array<size_t, BUCKETS> fill{};
+        for (size_t i = 0; i < N; ++i) {
+            const size_t b = bucket(hashes[i]);
+            members[offsets[b] + fill[b]++] = i;
+        }
+
+        // equal keys hash equally, so duplicates can only be in the same bucket
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            for (size_t i = offsets[b]; i < offsets[b + 1]; ++i) {
+                for (size_t j = offsets[b]; j < i; ++j) {
+                    if (entries[members[i]].first == entries[members[j]].first)
+                        throw std::logic_error("duplicate key in constexpr map");
+                }
+            }
+        }
+
+        // largest buckets are placed first while most slots are still free
+        std::array<size_t, BUCKETS> order{};
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            order[b] = b;
+        }
+        std::ranges::sort(order, [&offsets](size_t lhs, size_t rhs) {
+            const size_t lhsSize = offsets[lhs + 1] - offsets[lhs];
+            const size_t rhsSize = offsets[rhs + 1] - offsets[rhs];
+            return lhsSize != rhsSize ? lhsSize > rhsSize : lhs < rhs;
+        });
+
+        Layout layout;
+        std::array<bool, N> taken{};
+        std::array<size_t, N> slots{};
+        for (const size_t b : order) {
+            const size_t count = offsets[b + 1] - offsets[b];
+            if (count == 0)
+                break;
+
+            bool placed = false;
+            for (uint32_t pilot = 0; pilot < MAX_PILOT && !placed; ++pilot) {
+                const uint32_t mixed = static_cast<uint32_t>(ConstexprHash<uint32_t>{}(pilot));
+
+                bool free = true;
+                for (size_t k = 0; k < count && free; ++k) {
+                    slots[k] = slot(hashes[members[offsets[b] + k]], mixed);
+                    free = !taken[slots[k]] && std::find(slots.begin(), slots.begin() + k, slots[k]) == slots.begin() + k;
+                }
+                if (!free)
+                    continue;
+
+                for (size_t k = 0; k < count; ++k) {
+                    taken[slots[k]] = true;
+                    layout.sources[slots[k]] = members[offsets[b] + k];
+                }
+                layout.pilots[b] = mixed;
+                placed = true;
+            }
+            if (!placed)
+                throw std::logic_error("no perfect hash found for constexpr map");
+        }
+        return layout;
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    std::array<uint32_t, BUCKETS> m_pilots;
+    std::array<Node, N> m_entries;
+};
+
+// static constexpr auto handlers = makeStaticPerfectMap<uint16_t, Handler>({ {0x1000, &onDeviceType}, ... });
+template<typename K, typename V, size_t N, typename Hash = ConstexprHash<K>>
+consteval ConstexprMap<K, V, N, Hash> makeStaticPerfectMap(std::pair<K, V> (&&entries)[N])
+{
+    return ConstexprMap<K, V, N, Hash>(std::to_array(std::move(entries)));
+}
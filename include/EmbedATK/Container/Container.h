@@ -530,3 +530,26 @@ public:
     virtual T* data() = 0;
     virtual const T* data() const = 0;
 };
+
+//------------------------------------------------------
+//                      Hashing
+//------------------------------------------------------
+
+namespace detail {
+
+    // Fibonacci hashing: maps a hash to one of Buckets buckets through its top bits after a
+    // multiplication with 2^bits/phi, which also spreads the identity hashes of integral keys.
+    template<size_t Buckets>
+    requires (std::has_single_bit(Buckets))
+    constexpr size_t fibonacciBucket(const size_t hash) noexcept
+    {
+        constexpr int BITS = std::countr_zero(Buckets);
+        if constexpr (BITS == 0)
+            return 0;
+        else if constexpr (sizeof(size_t) == 8)
+            return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> (64 - BITS));
+        else
+            return static_cast<size_t>((hash * 0x9E3779B9u) >> (32 - BITS));
+    }
+
+}
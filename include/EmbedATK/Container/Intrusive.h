@@ -0,0 +1,578 @@
+#pragma once
+
+#include "Container.h"
+
+// Intrusive containers link objects through hooks embedded in the objects themselves,
+// so objects which already live in a pool can be queued, ordered or looked up without
+// allocating nodes. The containers never own their elements: an object has to stay alive
+// while it is linked and can be linked into one container per hook.
+// Copying an object does not copy its links, the copy starts unlinked.
+
+//------------------------------------------------------
+//                      Hooks
+//------------------------------------------------------
+
+template<typename T>
+struct IntrusiveListHook
+{
+    constexpr IntrusiveListHook() noexcept = default;
+    constexpr IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+    constexpr IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+    T* prev = nullptr;
+    T* next = nullptr;
+};
+
+template<typename T>
+struct IntrusiveHeapHook
+{
+    constexpr IntrusiveHeapHook() noexcept = default;
+    constexpr IntrusiveHeapHook(const IntrusiveHeapHook&) noexcept {}
+    constexpr IntrusiveHeapHook& operator=(const IntrusiveHeapHook&) noexcept { return *this; }
+
+    T* child = nullptr;
+    T* sibling = nullptr;
+    T* prev = nullptr; // parent for the first child, left sibling otherwise
+};
+
+template<typename T>
+struct IntrusiveHashHook
+{
+    constexpr IntrusiveHashHook() noexcept = default;
+    constexpr IntrusiveHashHook(const IntrusiveHashHook&) noexcept {}
+    constexpr IntrusiveHashHook& operator=(const IntrusiveHashHook&) noexcept { return *this; }
+
+    T* next = nullptr;
+};
+
+//------------------------------------------------------
+//                    Intrusive List
+//------------------------------------------------------
+
+// Doubly linked list, all operations besides clear() are O(1).
+//   struct Job { IntrusiveListHook<Job> hook; ... };
+//   IntrusiveList<Job, &Job::hook> pending;
+template<typename T, IntrusiveListHook<T> T::* Hook>
+class IntrusiveList
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using ValueType = T;
+
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, const T*, T*>;
+        using reference         = std::conditional_t<IsConst, const T&, T&>;
+
+        constexpr IteratorBase() noexcept = default;
+        constexpr IteratorBase(pointer node, const IntrusiveList* list) noexcept : m_node(node), m_list(list) {}
+        template<bool WasConst>
+        requires(IsConst && !WasConst)
+        constexpr IteratorBase(const IteratorBase<WasConst>& other) noexcept : m_node(other.m_node), m_list(other.m_list) {}
+
+        constexpr reference operator*() const noexcept { return *m_node; }
+        constexpr pointer operator->() const noexcept { return m_node; }
+
+        constexpr IteratorBase& operator++() noexcept { m_node = (m_node->*Hook).next; return *this; }
+        constexpr IteratorBase operator++(int) noexcept { auto tmp = *this; ++*this; return tmp; }
+        constexpr IteratorBase& operator--() noexcept { m_node = m_node ? (m_node->*Hook).prev : m_list->m_tail; return *this; }
+        constexpr IteratorBase operator--(int) noexcept { auto tmp = *this; --*this; return tmp; }
+
+        friend constexpr bool operator==(const IteratorBase& a, const IteratorBase& b) noexcept { return a.m_node == b.m_node; }
+
+    private:
+        friend class IteratorBase<true>;
+
+        pointer m_node = nullptr;
+        const IntrusiveList* m_list = nullptr; // end() has to step back to the tail
+    };
+
+    using Iterator      = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    constexpr IntrusiveList() noexcept = default;
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    constexpr IntrusiveList(IntrusiveList&& other) noexcept
+        : m_head(std::exchange(other.m_head, nullptr)), m_tail(std::exchange(other.m_tail, nullptr)), m_size(std::exchange(other.m_size, 0))
+    {}
+
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    constexpr Iterator begin() noexcept { return { m_head, this }; }
+    constexpr ConstIterator begin() const noexcept { return { m_head, this }; }
+    constexpr Iterator end() noexcept { return { nullptr, this }; }
+    constexpr ConstIterator end() const noexcept { return { nullptr, this }; }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr size_t size() const noexcept { return m_size; }
+
+    constexpr bool contains(const T& value) const noexcept
+    {
+        const auto& hook = value.*Hook;
+        return hook.prev != nullptr || hook.next != nullptr || m_head == &value;
+    }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    constexpr T* front() noexcept { return m_head; }
+    constexpr const T* front() const noexcept { return m_head; }
+    constexpr T* back() noexcept { return m_tail; }
+    constexpr const T* back() const noexcept { return m_tail; }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    constexpr void push_front(T& value) noexcept { insert(m_head, value); }
+    constexpr void push_back(T& value) noexcept { insert(nullptr, value); }
+
+    // links value in front of pos, at the back if pos is nullptr
+    constexpr void insert(T* pos, T& value) noexcept
+    {
+        auto& hook = value.*Hook;
+        hook.next = pos;
+        hook.prev = pos ? (pos->*Hook).prev : m_tail;
+
+        if (hook.prev) (hook.prev->*Hook).next = &value;
+        else m_head = &value;
+        if (pos) (pos->*Hook).prev = &value;
+        else m_tail = &value;
+
+        m_size++;
+    }
+
+    constexpr T* pop_front() noexcept
+    {
+        T* value = m_head;
+        if (value) erase(*value);
+        return value;
+    }
+
+    constexpr T* pop_back() noexcept
+    {
+        T* value = m_tail;
+        if (value) erase(*value);
+        return value;
+    }
+
+    // value has to be linked into this list, returns its successor
+    constexpr T* erase(T& value) noexcept
+    {
+        auto& hook = value.*Hook;
+        T* next = hook.next;
+
+        if (hook.prev) (hook.prev->*Hook).next = hook.next;
+        else m_head = hook.next;
+        if (hook.next) (hook.next->*Hook).prev = hook.prev;
+        else m_tail = hook.prev;
+
+        hook.prev = nullptr;
+        hook.next = nullptr;
+        m_size--;
+        return next;
+    }
+
+    // unlinks all elements, the elements themselves are untouched
+    constexpr void clear() noexcept
+    {
+        while (m_head) {
+            erase(*m_head);
+        }
+    }
+
+private:
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    T* m_head = nullptr;
+    T* m_tail = nullptr;
+    size_t m_size = 0;
+};
+
+//------------------------------------------------------
+//                Intrusive Pairing Heap
+//------------------------------------------------------
+
+// Min heap (with respect to Compare) for timers and schedulers. push() and top() are O(1),
+// pop() and erase() are amortized O(log n). To change the key of an element, erase it,
+// update it and push it again.
+template<typename T, IntrusiveHeapHook<T> T::* Hook, typename Compare = std::less<T>>
+class IntrusivePairingHeap
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using ValueType = T;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    constexpr IntrusivePairingHeap(Compare compare = {}) noexcept : m_compare(std::move(compare)) {}
+    IntrusivePairingHeap(const IntrusivePairingHeap&) = delete;
+    IntrusivePairingHeap& operator=(const IntrusivePairingHeap&) = delete;
+
+    ~IntrusivePairingHeap()
+    {
+        clear();
+    }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept { return m_root == nullptr; }
+    constexpr size_t size() const noexcept { return m_size; }
+
+    constexpr bool contains(const T& value) const noexcept
+    {
+        return (value.*Hook).prev != nullptr || m_root == &value;
+    }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    constexpr T* top() noexcept { return m_root; }
+    constexpr const T* top() const noexcept { return m_root; }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    constexpr void push(T& value) noexcept
+    {
+        m_root = m_root ? meld(m_root, &value) : &value;
+        m_size++;
+    }
+
+    constexpr T* pop() noexcept
+    {
+        T* root = m_root;
+        if (root) {
+            m_root = mergePairs((root->*Hook).child);
+            unlink(*root);
+        }
+        return root;
+    }
+
+    // value has to be linked into this heap
+    constexpr void erase(T& value) noexcept
+    {
+        if (&value == m_root) {
+            pop();
+            return;
+        }
+
+        // cut the subtree of value and meld its children back into the root
+        auto& hook = value.*Hook;
+        if ((hook.prev->*Hook).child == &value) (hook.prev->*Hook).child = hook.sibling;
+        else (hook.prev->*Hook).sibling = hook.sibling;
+        if (hook.sibling) (hook.sibling->*Hook).prev = hook.prev;
+
+        if (T* children = mergePairs(hook.child)) {
+            m_root = meld(m_root, children);
+        }
+        unlink(value);
+    }
+
+    // unlinks all elements, the elements themselves are untouched
+    constexpr void clear() noexcept
+    {
+        // the tree is flattened into a list through the sibling links while unlinking
+        T* pending = m_root;
+        while (pending) {
+            T* value = pending;
+            auto& hook = value->*Hook;
+            pending = hook.sibling;
+            if (T* child = hook.child) {
+                T* last = child;
+                while ((last->*Hook).sibling) last = (last->*Hook).sibling;
+                (last->*Hook).sibling = pending;
+                pending = child;
+            }
+            reset(hook);
+        }
+        m_root = nullptr;
+        m_size = 0;
+    }
+
+private:
+    // ----------------------------------------
+    // --- helpers
+    // ----------------------------------------
+    constexpr void unlink(T& value) noexcept
+    {
+        reset(value.*Hook);
+        m_size--;
+    }
+
+    static constexpr void reset(IntrusiveHeapHook<T>& hook) noexcept
+    {
+        hook.child = nullptr;
+        hook.sibling = nullptr;
+        hook.prev = nullptr;
+    }
+
+    // both are roots without siblings, the larger one becomes the first child of the smaller one
+    constexpr T* meld(T* a, T* b) noexcept
+    {
+        if (m_compare(*b, *a)) std::swap(a, b);
+
+        auto& parent = a->*Hook;
+        auto& child = b->*Hook;
+        child.sibling = parent.child;
+        if (child.sibling) (child.sibling->*Hook).prev = b;
+        child.prev = a;
+        parent.child = b;
+        parent.sibling = nullptr;
+        parent.prev = nullptr;
+        return a;
+    }
+
+    // two pass merge of a sibling list: pairs left to right, then the pairs right to left
+    constexpr T* mergePairs(T* first) noexcept
+    {
+        if (!first) return nullptr;
+
+        T* pairs = nullptr; // melded pairs, chained in reverse through the sibling link
+        while (first) {
+            T* a = first;
+            T* b = (a->*Hook).sibling;
+            first = b ? (b->*Hook).sibling : nullptr;
+
+            (a->*Hook).sibling = nullptr;
+            T* pair = a;
+            if (b) {
+                (b->*Hook).sibling = nullptr;
+                pair = meld(a, b);
+            }
+            (pair->*Hook).prev = nullptr;
+            (pair->*Hook).sibling = pairs;
+            pairs = pair;
+        }
+
+        T* root = pairs;
+        pairs = (root->*Hook).sibling;
+        (root->*Hook).sibling = nullptr;
+        while (pairs) {
+            T* next = (pairs->*Hook).sibling;
+            (pairs->*Hook).sibling = nullptr;
+            root = meld(root, pairs);
+            pairs = next;
+        }
+        return root;
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    T* m_root = nullptr;
+    size_t m_size = 0;
+    [[no_unique_address]] Compare m_compare;
+};
+
+//------------------------------------------------------
+//                 Intrusive Hash Table
+//------------------------------------------------------
+
+// Hash table with chained buckets, the key is a member of T:
+//   struct Session { IntrusiveHashHook<Session> hook; uint32_t id; ... };
+//   IntrusiveHashTable<Session, &Session::hook, &Session::id, 64> sessions;
+// Buckets has to be a power of two, keys are unique.
+template<typename T, IntrusiveHashHook<T> T::* Hook, auto Key, size_t Buckets,
+    typename Hash = std::hash<std::remove_cvref_t<decltype(std::declval<const T&>().*Key)>>,
+    typename KeyEqual = std::equal_to<std::remove_cvref_t<decltype(std::declval<const T&>().*Key)>>>
+class IntrusiveHashTable
+{
+    static_assert(Buckets >= 2 && std::has_single_bit(Buckets), "bucket count has to be a power of two");
+
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using ValueType = T;
+    using KeyType   = std::remove_cvref_t<decltype(std::declval<const T&>().*Key)>;
+
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, const T*, T*>;
+        using reference         = std::conditional_t<IsConst, const T&, T&>;
+        using Table             = std::conditional_t<IsConst, const IntrusiveHashTable, IntrusiveHashTable>;
+
+        constexpr IteratorBase() noexcept = default;
+        constexpr IteratorBase(Table* table, size_t bucket, pointer node) noexcept : m_table(table), m_bucket(bucket), m_node(node)
+        {
+            skipEmpty();
+        }
+        template<bool WasConst>
+        requires(IsConst && !WasConst)
+        constexpr IteratorBase(const IteratorBase<WasConst>& other) noexcept : m_table(other.m_table), m_bucket(other.m_bucket), m_node(other.m_node) {}
+
+        constexpr reference operator*() const noexcept { return *m_node; }
+        constexpr pointer operator->() const noexcept { return m_node; }
+
+        constexpr IteratorBase& operator++() noexcept
+        {
+            m_node = (m_node->*Hook).next;
+            skipEmpty();
+            return *this;
+        }
+        constexpr IteratorBase operator++(int) noexcept { auto tmp = *this; ++*this; return tmp; }
+
+        friend constexpr bool operator==(const IteratorBase& a, const IteratorBase& b) noexcept { return a.m_node == b.m_node; }
+
+    private:
+        friend class IteratorBase<true>;
+
+        constexpr void skipEmpty() noexcept
+        {
+            while (!m_node && ++m_bucket < Buckets) {
+                m_node = m_table->m_buckets[m_bucket];
+            }
+        }
+
+        Table* m_table = nullptr;
+        size_t m_bucket = Buckets;
+        pointer m_node = nullptr;
+    };
+
+    using Iterator      = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    constexpr IntrusiveHashTable() noexcept = default;
+    IntrusiveHashTable(const IntrusiveHashTable&) = delete;
+    IntrusiveHashTable& operator=(const IntrusiveHashTable&) = delete;
+
+    ~IntrusiveHashTable()
+    {
+        clear();
+    }
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    constexpr Iterator begin() noexcept { return { this, 0, m_buckets[0] }; }
+    constexpr ConstIterator begin() const noexcept { return { this, 0, m_buckets[0] }; }
+    constexpr Iterator end() noexcept { return { this, Buckets, nullptr }; }
+    constexpr ConstIterator end() const noexcept { return { this, Buckets, nullptr }; }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr size_t size() const noexcept { return m_size; }
+    constexpr size_t bucketCount() const noexcept { return Buckets; }
+    constexpr bool contains(const KeyType& key) const { return find(key) != nullptr; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    constexpr T* find(const KeyType& key)
+    {
+        return const_cast<T*>(std::as_const(*this).find(key));
+    }
+
+    constexpr const T* find(const KeyType& key) const
+    {
+        for (T* node = m_buckets[bucket(key)]; node; node = (node->*Hook).next) {
+            if (KeyEqual{}(node->*Key, key))
+                return node;
+        }
+        return nullptr;
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    // returns false if an element with the same key is already linked
+    constexpr bool insert(T& value)
+    {
+        T*& head = m_buckets[bucket(value.*Key)];
+        for (T* node = head; node; node = (node->*Hook).next) {
+            if (KeyEqual{}(node->*Key, value.*Key))
+                return false;
+        }
+
+        (value.*Hook).next = head;
+        head = &value;
+        m_size++;
+        return true;
+    }
+
+    constexpr T* erase(const KeyType& key)
+    {
+        for (T** link = &m_buckets[bucket(key)]; *link; link = &((*link)->*Hook).next) {
+            T* node = *link;
+            if (KeyEqual{}(node->*Key, key)) {
+                *link = (node->*Hook).next;
+                (node->*Hook).next = nullptr;
+                m_size--;
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    // value has to be linked into this table
+    constexpr void erase(T& value)
+    {
+        for (T** link = &m_buckets[bucket(value.*Key)]; *link; link = &((*link)->*Hook).next) {
+            if (*link == &value) {
+                *link = (value.*Hook).next;
+                (value.*Hook).next = nullptr;
+                m_size--;
+                return;
+            }
+        }
+    }
+
+    // unlinks all elements, the elements themselves are untouched
+    constexpr void clear() noexcept
+    {
+        for (T*& head : m_buckets) {
+            while (head) {
+                head = std::exchange((head->*Hook).next, nullptr);
+            }
+        }
+        m_size = 0;
+    }
+
+private:
+    // ----------------------------------------
+    // --- helpers
+    // ----------------------------------------
+    static constexpr size_t bucket(const KeyType& key) { return detail::fibonacciBucket<Buckets>(Hash{}(key)); }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    std::array<T*, Buckets> m_buckets{};
+    size_t m_size = 0;
+};
@@ -0,0 +1,362 @@
+#pragma once
+
+#include "EmbedATK/Core/Core.h"
+
+#include "EmbedATK/Memory/Store.h"
+
+//------------------------------------------------------
+//                   Lock-free Queue
+//------------------------------------------------------
+
+enum class QueueProducers
+{
+    Single,
+    Multi
+};
+
+// One ring entry, padded to a full cache line so that a producer writing slot i
+// never invalidates the line the consumer is reading in slot i-1.
+// The sequence number encodes the slot state (Vyukov bounded queue):
+//   sequence == pos              -> free, may be written by the producer claiming pos
+//   sequence == pos + 1          -> filled, may be read by the consumer at pos
+//   sequence == pos + capacity   -> released, free for the next lap
+template<typename T>
+struct alignas(EATK_CACHE_LINE_SIZE) LockFreeQueueSlot
+{
+    T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage.data())); }
+    const T* value() const noexcept { return std::launder(reinterpret_cast<const T*>(storage.data())); }
+
+    std::atomic_size_t sequence = 0;
+    alignas(T) std::array<std::byte, sizeof(T)> storage;
+};
+
+// Bounded single-consumer queue over a ring of LockFreeQueueSlot's.
+// Producers never take a lock, with QueueProducers::Single the tail is advanced
+// without any read-modify-write. The consumer side must only be used by one thread.
+template<typename T, QueueProducers Producers>
+class LockFreeQueueBase
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using ValueType = T;
+    using SlotType  = LockFreeQueueSlot<ValueType>;
+    using StoreType = IObjectStore<SlotType>;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    LockFreeQueueBase(const LockFreeQueueBase&) = delete;
+    LockFreeQueueBase(LockFreeQueueBase&&) = delete;
+    virtual ~LockFreeQueueBase() = default;
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    bool empty() const noexcept
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        return m_slots[head & m_mask].sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+    // approximation if producers are active concurrently
+    size_t size() const noexcept
+    {
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        const size_t head = m_head.load(std::memory_order_acquire);
+        return tail > head ? std::min(tail - head, capacity()) : 0;
+    }
+
+    constexpr size_t capacity() const noexcept { return m_slots.size(); }
+
+    // ----------------------------------------
+    // --- manipulation (producers)
+    // ----------------------------------------
+    bool push(const ValueType& value)
+    {
+        if constexpr (std::is_copy_constructible_v<ValueType>) {
+            return emplace(value);
+        }
+        else {
+            return false;
+        }
+    }
+
+    bool push(ValueType&& value)
+    {
+        if constexpr (std::is_move_constructible_v<ValueType>) {
+            return emplace(std::move(value));
+        }
+        else {
+            return false;
+        }
+    }
+
+    template<class... Args>
+    bool emplace(Args&&... args)
+    {
+        size_t pos;
+        SlotType* slot = claim(1, pos);
+        if (!slot) return false;
+
+        std::construct_at(slot->value(), std::forward<Args>(args)...);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // pushes all elements of the range or none of them
+    template<std::ranges::sized_range Range>
+    bool pushMany(Range&& range)
+    {
+        const size_t count = std::ranges::size(range);
+        if (count == 0) return true;
+
+        size_t pos;
+        if (!claim(count, pos)) return false;
+
+        for (auto&& value : range) {
+            SlotType& slot = m_slots[pos & m_mask];
+            if constexpr (std::is_rvalue_reference_v<Range&&>) {
+                std::construct_at(slot.value(), std::move(value));
+            }
+            else {
+                std::construct_at(slot.value(), value);
+            }
+            slot.sequence.store(pos + 1, std::memory_order_release);
+            ++pos;
+        }
+        return true;
+    }
+
+    // ----------------------------------------
+    // --- manipulation (consumer)
+    // ----------------------------------------
+    std::optional<ValueType> pop()
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        SlotType& slot = m_slots[head & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+            return std::nullopt;
+
+        std::optional<ValueType> value = std::move(*slot.value());
+        release(slot, head);
+        return value;
+    }
+
+    // hands up to max elements to the callback in FIFO order, returns the number consumed
+    template<typename Callback>
+    requires std::invocable<Callback, ValueType&&>
+    size_t consume(Callback&& cb, size_t max = std::numeric_limits<size_t>::max())
+    {
+        size_t count = 0;
+        size_t head = m_head.load(std::memory_order_relaxed);
+        while (count < max) {
+            SlotType& slot = m_slots[head & m_mask];
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+                break;
+
+            std::invoke(cb, std::move(*slot.value()));
+            release(slot, head++);
+            ++count;
+        }
+        return count;
+    }
+
+    void clear()
+    {
+        consume([](ValueType&&) {});
+    }
+
+    // ----------------------------------------
+    // --- in place access (consumer)
+    // ----------------------------------------
+    // Elements that were ready when the view was taken, accessed in place in the ring.
+    // They are destroyed and their slots handed back to the producers in one go when the view goes away.
+    class DrainView
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = ValueType;
+            using pointer           = ValueType*;
+            using reference         = ValueType&;
+
+            Iterator() = default;
+            Iterator(std::span<SlotType> slots, const size_t mask, const size_t pos)
+                : m_slots(slots), m_mask(mask), m_pos(pos) {}
+
+            reference operator*() const { return *m_slots[m_pos & m_mask].value(); }
+            pointer operator->() const { return m_slots[m_pos & m_mask].value(); }
+            Iterator& operator++() { ++m_pos; return *this; }
+            Iterator operator++(int) { Iterator tmp = *this; ++m_pos; return tmp; }
+            bool operator==(const Iterator& other) const { return m_pos == other.m_pos; }
+
+        private:
+            std::span<SlotType> m_slots;
+            size_t m_mask = 0;
+            size_t m_pos = 0;
+        };
+
+        DrainView(const DrainView&) = delete;
+        DrainView& operator=(const DrainView&) = delete;
+        ~DrainView() { m_queue.release(m_head, m_count); }
+
+        bool empty() const noexcept { return m_count == 0; }
+        size_t size() const noexcept { return m_count; }
+
+        Iterator begin() const { return Iterator{m_queue.m_slots, m_queue.m_mask, m_head}; }
+        Iterator end() const { return Iterator{m_queue.m_slots, m_queue.m_mask, m_head + m_count}; }
+
+        // the slots of the view as they lie in the ring, the second segment is only used if it wraps
+        std::array<std::span<SlotType>, 2> segments() const
+        {
+            const size_t first = m_head & m_queue.m_mask;
+            const size_t firstCount = std::min(m_count, m_queue.capacity() - first);
+            return { m_queue.m_slots.subspan(first, firstCount), m_queue.m_slots.subspan(0, m_count - firstCount) };
+        }
+
+    private:
+        DrainView(LockFreeQueueBase& queue, const size_t head, const size_t count)
+            : m_queue(queue), m_head(head), m_count(count) {}
+
+        LockFreeQueueBase& m_queue;
+        size_t m_head;
+        size_t m_count;
+
+        friend class LockFreeQueueBase;
+    };
+
+    // takes up to max ready elements without moving them out of the ring
+    DrainView drain(const size_t max = std::numeric_limits<size_t>::max())
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t limit = std::min(max, capacity());
+        size_t count = 0;
+        while (count < limit && m_slots[(head + count) & m_mask].sequence.load(std::memory_order_acquire) == head + count + 1) {
+            ++count;
+        }
+        return DrainView{*this, head, count};
+    }
+
+protected:
+    LockFreeQueueBase() = default;
+
+    void attach(std::span<SlotType> slots)
+    {
+        if (!std::has_single_bit(slots.size()))
+            throw std::invalid_argument("lock-free queue capacity must be a power of two");
+
+        m_slots = slots;
+        m_mask = slots.size() - 1;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_head.store(0, std::memory_order_relaxed);
+        m_tail.store(0, std::memory_order_release);
+    }
+
+private:
+    // reserves count consecutive free slots starting at pos
+    SlotType* claim(size_t count, size_t& pos)
+    {
+        if (count > capacity()) return nullptr;
+
+        pos = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            // the last slot of the range is released last by the consumer
+            SlotType& last = m_slots[(pos + count - 1) & m_mask];
+            const auto diff = static_cast<std::ptrdiff_t>(last.sequence.load(std::memory_order_acquire) - (pos + count - 1));
+
+            if (diff == 0) {
+                if constexpr (Producers == QueueProducers::Single) {
+                    m_tail.store(pos + count, std::memory_order_relaxed);
+                    return &m_slots[pos & m_mask];
+                }
+                else {
+                    if (m_tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                        return &m_slots[pos & m_mask];
+                }
+            }
+            else if (diff < 0) {
+                return nullptr; // full
+            }
+            else {
+                pos = m_tail.load(std::memory_order_relaxed); // another producer was faster
+            }
+        }
+    }
+
+    void release(SlotType& slot, size_t head)
+    {
+        std::destroy_at(slot.value());
+        slot.sequence.store(head + capacity(), std::memory_order_release);
+        m_head.store(head + 1, std::memory_order_relaxed);
+    }
+
+    void release(const size_t head, const size_t count)
+    {
+        for (size_t pos = head; pos < head + count; ++pos) {
+            SlotType& slot = m_slots[pos & m_mask];
+            std::destroy_at(slot.value());
+            slot.sequence.store(pos + capacity(), std::memory_order_release);
+        }
+        m_head.store(head + count, std::memory_order_relaxed);
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    std::span<SlotType> m_slots;
+    size_t m_mask = 0;
+
+    alignas(EATK_CACHE_LINE_SIZE) std::atomic_size_t m_tail = 0;
+    alignas(EATK_CACHE_LINE_SIZE) std::atomic_size_t m_head = 0;
+};
+
+template<typename T, size_t N, QueueProducers Producers = QueueProducers::Multi>
+class StaticLockFreeQueue : public LockFreeQueueBase<T, Producers>
+{
+    static_assert(std::has_single_bit(N), "lock-free queue capacity must be a power of two");
+
+    using Base      = LockFreeQueueBase<T, Producers>;
+    using SlotType  = Base::SlotType;
+
+public:
+    StaticLockFreeQueue()
+    {
+        m_store.construct(0, N);
+        Base::attach(std::span<SlotType>{m_store.data(), m_store.size()});
+    }
+
+    ~StaticLockFreeQueue()
+    {
+        Base::clear();
+    }
+
+private:
+    StaticObjectStore<SlotType, N, false> m_store;
+};
+
+template<typename T, QueueProducers Producers = QueueProducers::Multi>
+class LockFreeQueueView : public LockFreeQueueBase<T, Producers>
+{
+    using Base      = LockFreeQueueBase<T, Producers>;
+    using SlotType  = Base::SlotType;
+    using StoreType = Base::StoreType;
+
+public:
+    LockFreeQueueView(StoreType& store)
+    {
+        store.construct(0, store.size());
+        Base::attach(std::span<SlotType>{store.data(), store.size()});
+    }
+
+    ~LockFreeQueueView()
+    {
+        Base::clear();
+    }
+};
@@ -2,6 +2,9 @@
 
 #include "Container.h"
 
+#include "EmbedATK/Memory/Pool.h"
+#include "EmbedATK/Memory/Store.h"
+
 //------------------------------------------------------
 //                      Map
 //------------------------------------------------------
@@ -29,6 +32,7 @@ public:
     // ----------------------------------------
     virtual bool full() const noexcept = 0;
     virtual size_t capacity() const noexcept = 0;
+    virtual bool contains(const KeyType& key) const = 0;
 
     // ----------------------------------------
     // --- manipulation
@@ -111,6 +115,7 @@ public:
     bool full() const noexcept override { return m_map.size() >= N; };
     size_t size() const noexcept override { return m_map.size(); }
     size_t capacity() const noexcept override { return N; }
+    bool contains(const KeyType& key) const override { return m_map.contains(key); }
 
     // ----------------------------------------
     // --- data access
@@ -148,4 +153,594 @@ private:
 };
 
 static_assert(std::ranges::bidirectional_range<StaticStdMap<int, float, 5>>);
-static_assert(std::ranges::bidirectional_range<const StaticStdMap<int, float, 5>>);
\ No newline at end of file
+static_assert(std::ranges::bidirectional_range<const StaticStdMap<int, float, 5>>);
+
+namespace detail {
+
+    struct FlatMapKey
+    {
+        template<typename Node>
+        constexpr const auto& operator()(const Node& node) const noexcept { return node.first; }
+    };
+
+    // Robin Hood open addressing over inline storage, shared by StaticFlatMap and StaticFlatSet.
+    // Every slot records its distance from the home slot + 1 (0 = empty). Lookups stop at the first
+    // entry that is closer to its home than the key would be, erasing shifts the following run back
+    // so no tombstones are needed.
+    template<typename Node, typename Key, typename KeyOf, size_t N, typename Hash, typename KeyEqual>
+    class FlatTable
+    {
+        static_assert(N > 0, "flat table needs a capacity");
+
+    public:
+        // load factor stays below 0.8
+        static constexpr size_t SLOTS   = std::bit_ceil(N + N / 4 + 1);
+        static constexpr size_t MASK    = SLOTS - 1;
+        static constexpr size_t NPOS    = SLOTS;
+
+        template<bool IsConst>
+        struct TableIterator
+        {
+            // ----------------------------------------
+            // --- types
+            // ----------------------------------------
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = Node;
+            using pointer           = std::conditional_t<IsConst, const Node*, Node*>;
+            using reference         = std::conditional_t<IsConst, const Node&, Node&>;
+            using owner_type        = std::conditional_t<IsConst, const FlatTable, FlatTable>;
+
+            // ----------------------------------------
+            // --- constructors/destructors
+            // ----------------------------------------
+            constexpr TableIterator() = default;
+            constexpr TableIterator(owner_type* owner, size_t index) : owner{ owner }, index{ index } {}
+            template<bool WasConst>
+            requires(IsConst && !WasConst)
+            constexpr TableIterator(const TableIterator<WasConst>& other) : owner{ other.owner }, index{ other.index } {}
+
+            constexpr bool operator==(const TableIterator& other) const { return index == other.index; }
+
+            // ----------------------------------------
+            // --- data access
+            // ----------------------------------------
+            reference operator*() const { return owner->node(index); }
+            pointer operator->() const { return &owner->node(index); }
+
+            // ----------------------------------------
+            // --- manipulation
+            // ----------------------------------------
+            TableIterator& operator++() { index = owner->next(index); return *this; }
+            TableIterator operator++(int) { TableIterator tmp = *this; ++(*this); return tmp; }
+            TableIterator& operator--() { index = owner->prev(index); return *this; }
+            TableIterator operator--(int) { TableIterator tmp = *this; --(*this); return tmp; }
+
+            // ----------------------------------------
+            // --- data
+            // ----------------------------------------
+            owner_type* owner = nullptr;
+            size_t index = 0;
+        };
+
+        // ----------------------------------------
+        // --- constructors/destructors
+        // ----------------------------------------
+        FlatTable() noexcept = default;
+
+        FlatTable(const FlatTable& other) { copyFrom(other); }
+        FlatTable(FlatTable&& other) noexcept { moveFrom(std::move(other)); }
+
+        FlatTable& operator=(const FlatTable& other)
+        {
+            if (this != &other) {
+                clear();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        FlatTable& operator=(FlatTable&& other) noexcept
+        {
+            if (this != &other) {
+                clear();
+                moveFrom(std::move(other));
+            }
+            return *this;
+        }
+
+        ~FlatTable() { clear(); }
+
+        // ----------------------------------------
+        // --- information
+        // ----------------------------------------
+        size_t size() const noexcept { return m_size; }
+
+        // ----------------------------------------
+        // --- data access
+        // ----------------------------------------
+        Node& node(size_t index) noexcept { return m_store.data()[index]; }
+        const Node& node(size_t index) const noexcept { return m_store.data()[index]; }
+
+        size_t first() const noexcept { return m_size == 0 ? NPOS : next(static_cast<size_t>(-1)); }
+
+        size_t next(size_t index) const noexcept
+        {
+            do { ++index; } while (index < SLOTS && m_dist[index] == 0);
+            return index;
+        }
+
+        size_t prev(size_t index) const noexcept
+        {
+            do { --index; } while (m_dist[index] == 0);
+            return index;
+        }
+
+        size_t find(const Key& key) const
+        {
+            size_t index = home(key);
+            for (size_t dist = 1; m_dist[index] >= dist; ++dist) {
+                if (m_dist[index] == dist && KeyEqual{}(KeyOf{}(node(index)), key))
+                    return index;
+                index = (index + 1) & MASK;
+            }
+            return NPOS;
+        }
+
+        // ----------------------------------------
+        // --- manipulation
+        // ----------------------------------------
+        void clear() noexcept
+        {
+            for (size_t i = 0; i < SLOTS; ++i) {
+                if (m_dist[i] != 0) std::destroy_at(&node(i));
+            }
+            m_dist.fill(0);
+            m_size = 0;
+        }
+
+        // the key of the node must not be in the table yet, returns the slot it ended up in
+        size_t insert(Node&& value)
+        {
+            if (m_size >= N) throw std::length_error("map size exceeds static capacity");
+
+            const size_t start = home(KeyOf{}(value));
+            if (!probeFits(start)) throw std::length_error("flat map probe sequence too long");
+
+            std::optional<Node> carry;
+            Node* pending = &value;
+            size_t index = start;
+            size_t placed = NPOS;
+            uint8_t dist = 1;
+            while (m_dist[index] != 0) {
+                if (m_dist[index] < dist) {
+                    // the resident is closer to its home and hands its slot to the pending node
+                    Node displaced(std::move(node(index)));
+                    std::destroy_at(&node(index));
+                    std::construct_at(&node(index), std::move(*pending));
+                    std::swap(dist, m_dist[index]);
+                    carry.emplace(std::move(displaced));
+                    pending = &*carry;
+                    if (placed == NPOS) placed = index;
+                }
+                ++dist;
+                index = (index + 1) & MASK;
+            }
+
+            std::construct_at(&node(index), std::move(*pending));
+            m_dist[index] = dist;
+            ++m_size;
+            return placed == NPOS ? index : placed;
+        }
+
+        void erase(size_t index) noexcept
+        {
+            std::destroy_at(&node(index));
+            size_t next = (index + 1) & MASK;
+            while (m_dist[next] > 1) {
+                std::construct_at(&node(index), std::move(node(next)));
+                std::destroy_at(&node(next));
+                m_dist[index] = m_dist[next] - 1;
+                index = next;
+                next = (next + 1) & MASK;
+            }
+            m_dist[index] = 0;
+            --m_size;
+        }
+
+    private:
+        static size_t home(const Key& key) { return fibonacciBucket<SLOTS>(Hash{}(key)); }
+
+        // replays the distances insert() hands along the chain up to the first empty slot without
+        // moving anything, so a too long sequence is rejected before the table is touched
+        bool probeFits(size_t index) const noexcept
+        {
+            uint8_t dist = 1;
+            while (m_dist[index] != 0) {
+                dist = std::min(dist, m_dist[index]);
+                if (dist == std::numeric_limits<uint8_t>::max()) return false;
+                ++dist;
+                index = (index + 1) & MASK;
+            }
+            return true;
+        }
+
+        void copyFrom(const FlatTable& other)
+        {
+            for (size_t i = 0; i < SLOTS; ++i) {
+                if (other.m_dist[i] != 0) std::construct_at(&node(i), other.node(i));
+            }
+            m_dist = other.m_dist;
+            m_size = other.m_size;
+        }
+
+        void moveFrom(FlatTable&& other)
+        {
+            for (size_t i = 0; i < SLOTS; ++i) {
+                if (other.m_dist[i] != 0) std::construct_at(&node(i), std::move(other.node(i)));
+            }
+            m_dist = other.m_dist;
+            m_size = other.m_size;
+            other.clear();
+        }
+
+        // ----------------------------------------
+        // --- data
+        // ----------------------------------------
+        std::array<uint8_t, SLOTS> m_dist{};
+        StaticObjectStore<Node, SLOTS, false> m_store;
+        size_t m_size = 0;
+    };
+
+}
+
+//------------------------------------------------------
+//                      Flat Map
+//------------------------------------------------------
+
+// Fixed capacity hash map with all entries stored inline, no allocation per node.
+// Iterators and references are invalidated by insert and erase.
+template<typename K, typename V, size_t N, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class StaticFlatMap : public IMap<K, V>
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using Handle        = IMap<K, V>;
+    using KeyType       = Handle::KeyType;
+    using ValueType     = Handle::ValueType;
+    using Iterator      = Handle::Iterator;
+    using ConstIterator = Handle::ConstIterator;
+    using Node          = std::pair<const KeyType, ValueType>;
+    using Table         = detail::FlatTable<Node, KeyType, detail::FlatMapKey, N, Hash, KeyEqual>;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    StaticFlatMap() = default;
+    StaticFlatMap(const StaticFlatMap& other) = default;
+    StaticFlatMap(StaticFlatMap&& other) noexcept = default;
+    StaticFlatMap& operator=(const StaticFlatMap& other) = default;
+    StaticFlatMap& operator=(StaticFlatMap&& other) noexcept = default;
+    ~StaticFlatMap() = default;
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    Iterator begin() override { return Iterator(typename Table::template TableIterator<false>{&m_table, m_table.first()}); }
+    ConstIterator begin() const override { return ConstIterator(typename Table::template TableIterator<true>{&m_table, m_table.first()}); }
+    Iterator end() override { return Iterator(typename Table::template TableIterator<false>{&m_table, Table::NPOS}); }
+    ConstIterator end() const override { return ConstIterator(typename Table::template TableIterator<true>{&m_table, Table::NPOS}); }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    bool empty() const noexcept override { return m_table.size() == 0; }
+    bool full() const noexcept override { return m_table.size() >= N; }
+    size_t size() const noexcept override { return m_table.size(); }
+    size_t capacity() const noexcept override { return N; }
+    bool contains(const KeyType& key) const override { return m_table.find(key) != Table::NPOS; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    ValueType& operator[](const KeyType& key) override
+    {
+        size_t index = m_table.find(key);
+        if (index == Table::NPOS)
+            index = m_table.insert(Node(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()));
+        return m_table.node(index).second;
+    }
+
+    const ValueType& operator[](const KeyType& key) const override { return at(key); }
+
+    ValueType& at(const KeyType& key) override
+    {
+        const size_t index = m_table.find(key);
+        if (index == Table::NPOS) throw std::out_of_range("key not found in map");
+        return m_table.node(index).second;
+    }
+
+    const ValueType& at(const KeyType& key) const override
+    {
+        const size_t index = m_table.find(key);
+        if (index == Table::NPOS) throw std::out_of_range("key not found in map");
+        return m_table.node(index).second;
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    void clear() noexcept override { m_table.clear(); }
+
+    std::pair<Iterator, bool> insert(const Node& node) override
+    {
+        return emplace(node);
+    }
+
+    size_t erase(const KeyType& key) override
+    {
+        const size_t index = m_table.find(key);
+        if (index == Table::NPOS) return 0;
+        m_table.erase(index);
+        return 1;
+    }
+
+    template<class... Args>
+    std::pair<Iterator, bool> emplace(Args&&... args)
+    {
+        Node node(std::forward<Args>(args)...);
+        size_t index = m_table.find(node.first);
+        const bool inserted = index == Table::NPOS;
+        if (inserted)
+            index = m_table.insert(std::move(node));
+        return std::make_pair(Iterator(typename Table::template TableIterator<false>{&m_table, index}), inserted);
+    }
+
+private:
+    Table m_table;
+};
+
+static_assert(std::ranges::bidirectional_range<StaticFlatMap<int, float, 5>>);
+static_assert(std::ranges::bidirectional_range<const StaticFlatMap<int, float, 5>>);
+
+//------------------------------------------------------
+//                      Sorted Map
+//------------------------------------------------------
+
+// Entries kept sorted in a contiguous array, binary search on lookup.
+// Meant for maps with a handful of entries where hashing does not pay off.
+template<typename K, typename V, size_t N, typename Compare = std::less<K>>
+class StaticSortedMap : public IMap<K, V>
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using Handle        = IMap<K, V>;
+    using KeyType       = Handle::KeyType;
+    using ValueType     = Handle::ValueType;
+    using Iterator      = Handle::Iterator;
+    using ConstIterator = Handle::ConstIterator;
+    using Node          = std::pair<const KeyType, ValueType>;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    StaticSortedMap() noexcept : m_store{}, m_size{ 0 } {}
+
+    StaticSortedMap(const StaticSortedMap& other) : m_store{}, m_size{ other.m_size }
+    {
+        std::uninitialized_copy_n(other.data(), m_size, data());
+    }
+
+    StaticSortedMap(StaticSortedMap&& other) noexcept : m_store{}, m_size{ other.m_size }
+    {
+        std::uninitialized_move_n(other.data(), m_size, data());
+        other.clear();
+    }
+
+    StaticSortedMap& operator=(const StaticSortedMap& other)
+    {
+        if (this != &other) {
+            clear();
+            std::uninitialized_copy_n(other.data(), other.m_size, data());
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    StaticSortedMap& operator=(StaticSortedMap&& other) noexcept
+    {
+        if (this != &other) {
+            clear();
+            std::uninitialized_move_n(other.data(), other.m_size, data());
+            m_size = other.m_size;
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~StaticSortedMap() { clear(); }
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    Iterator begin() override { return Iterator(data()); }
+    ConstIterator begin() const override { return ConstIterator(data()); }
+    Iterator end() override { return Iterator(data() + m_size); }
+    ConstIterator end() const override { return ConstIterator(data() + m_size); }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    bool empty() const noexcept override { return m_size == 0; }
+    bool full() const noexcept override { return m_size >= N; }
+    size_t size() const noexcept override { return m_size; }
+    size_t capacity() const noexcept override { return N; }
+    bool contains(const KeyType& key) const override { return find(key) != m_size; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    ValueType& operator[](const KeyType& key) override
+    {
+        const size_t index = lowerBound(key);
+        if (index < m_size && !Compare{}(key, data()[index].first))
+            return data()[index].second;
+        return insertAt(index, Node(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple())).second;
+    }
+
+    const ValueType& operator[](const KeyType& key) const override { return at(key); }
+
+    ValueType& at(const KeyType& key) override
+    {
+        const size_t index = find(key);
+        if (index == m_size) throw std::out_of_range("key not found in map");
+        return data()[index].second;
+    }
+
+    const ValueType& at(const KeyType& key) const override
+    {
+        const size_t index = find(key);
+        if (index == m_size) throw std::out_of_range("key not found in map");
+        return data()[index].second;
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    void clear() noexcept override
+    {
+        std::destroy_n(data(), m_size);
+        m_size = 0;
+    }
+
+    std::pair<Iterator, bool> insert(const Node& node) override
+    {
+        return emplace(node);
+    }
+
+    size_t erase(const KeyType& key) override
+    {
+        const size_t index = find(key);
+        if (index == m_size) return 0;
+
+        std::destroy_at(&data()[index]);
+        for (size_t i = index; i + 1 < m_size; ++i) {
+            std::construct_at(&data()[i], std::move(data()[i + 1]));
+            std::destroy_at(&data()[i + 1]);
+        }
+        m_size--;
+        return 1;
+    }
+
+    template<class... Args>
+    std::pair<Iterator, bool> emplace(Args&&... args)
+    {
+        Node node(std::forward<Args>(args)...);
+        const size_t index = lowerBound(node.first);
+        if (index < m_size && !Compare{}(node.first, data()[index].first))
+            return std::make_pair(Iterator(data() + index), false);
+        insertAt(index, std::move(node));
+        return std::make_pair(Iterator(data() + index), true);
+    }
+
+private:
+    Node* data() noexcept { return m_store.data(); }
+    const Node* data() const noexcept { return m_store.data(); }
+
+    size_t lowerBound(const KeyType& key) const
+    {
+        const Node* it = std::lower_bound(data(), data() + m_size, key, 
+            [](const Node& node, const KeyType& k) { return Compare{}(node.first, k); });
+        return static_cast<size_t>(it - data());
+    }
+
+    size_t find(const KeyType& key) const
+    {
+        const size_t index = lowerBound(key);
+        return (index < m_size && !Compare{}(key, data()[index].first)) ? index : m_size;
+    }
+
+    Node& insertAt(size_t index, Node&& node)
+    {
+        if (full()) throw std::length_error("map size exceeds static capacity");
+
+        // keys are const, entries are shifted by reconstructing them one slot further
+        for (size_t i = m_size; i > index; --i) {
+            std::construct_at(&data()[i], std::move(data()[i - 1]));
+            std::destroy_at(&data()[i - 1]);
+        }
+        std::construct_at(&data()[index], std::move(node));
+        m_size++;
+        return data()[index];
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    StaticObjectStore<Node, N, false> m_store;
+    size_t m_size;
+};
+
+static_assert(std::ranges::bidirectional_range<StaticSortedMap<int, float, 5>>);
+static_assert(std::ranges::bidirectional_range<const StaticSortedMap<int, float, 5>>);
+
+//------------------------------------------------------
+//                      Flat Set
+//------------------------------------------------------
+
+// Fixed capacity hash set on the same inline Robin Hood table as StaticFlatMap.
+template<typename K, size_t N, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class StaticFlatSet
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using KeyType       = K;
+    using Table         = detail::FlatTable<KeyType, KeyType, std::identity, N, Hash, KeyEqual>;
+    using ConstIterator = Table::template TableIterator<true>;
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    ConstIterator begin() const { return ConstIterator{&m_table, m_table.first()}; }
+    ConstIterator end() const { return ConstIterator{&m_table, Table::NPOS}; }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    bool empty() const noexcept { return m_table.size() == 0; }
+    bool full() const noexcept { return m_table.size() >= N; }
+    size_t size() const noexcept { return m_table.size(); }
+    size_t capacity() const noexcept { return N; }
+    bool contains(const KeyType& key) const { return m_table.find(key) != Table::NPOS; }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    void clear() noexcept { m_table.clear(); }
+
+    bool insert(const KeyType& key)
+    {
+        if (contains(key)) return false;
+        m_table.insert(KeyType(key));
+        return true;
+    }
+
+    size_t erase(const KeyType& key)
+    {
+        const size_t index = m_table.find(key);
+        if (index == Table::NPOS) return 0;
+        m_table.erase(index);
+        return 1;
+    }
+
+private:
+    Table m_table;
+};
+
+static_assert(std::ranges::bidirectional_range<const StaticFlatSet<int, 5>>);
@@ -54,6 +54,23 @@ public:
     virtual Iterator erase(ConstIterator pos) = 0;
     virtual Iterator erase(ConstIterator first, ConstIterator last) = 0;
 
+    // bulk operations, capacity is checked once and elements are transferred in contiguous runs
+    virtual bool pushN(std::span<const ValueType> values) = 0;
+    virtual bool pushN(std::move_iterator<ValueType*> first, std::move_iterator<ValueType*> last) = 0;
+    virtual size_t popN(std::span<ValueType> out) = 0;
+
+    // hands up to max elements to the callback in FIFO order, returns the number consumed
+    template<typename Callback>
+    requires std::invocable<Callback, ValueType&&>
+    size_t consume(Callback&& cb, size_t max = std::numeric_limits<size_t>::max())
+    {
+        using CallbackType = std::remove_reference_t<Callback>;
+        const ConsumeFn fn = [](void* context, ValueType&& value) {
+            std::invoke(*static_cast<CallbackType*>(context), std::move(value));
+        };
+        return consumeImpl(fn, const_cast<void*>(static_cast<const void*>(std::addressof(cb))), max);
+    }
+
     void swap(IQueue<ValueType>& other) 
     { 
         if (this->size() > other.capacity() || other.size() > capacity()) 
@@ -73,207 +90,25 @@ public:
             resize(minSize);
         }
     }
-};
-
-template<typename T, size_t N>
-requires std::default_initializable<T>
-class StaticStdQueue : public IQueue<T>
-{
-public:
-    // ----------------------------------------
-    // --- types
-    // ----------------------------------------
-    using Handle                = IQueue<T>;
-    using ValueType             = Handle::ValueType;
-    using Iterator              = Handle::Iterator;
-    using ConstIterator         = Handle::ConstIterator;
-    using OptionalRef           = Handle::OptionalRef;
-
-    // ----------------------------------------
-    // --- constructors/destructors
-    // ----------------------------------------
-    StaticStdQueue() 
-        : m_pool{}, m_queue{&m_pool}
-    { 
-    }
-    StaticStdQueue(size_t size)
-        : m_pool{}, m_queue{&m_pool}
-    {
-        if (size > N) throw std::length_error("queue exceeds static capacity");
-        m_queue.resize(size);
-    }
-    StaticStdQueue(size_t size, const ValueType& val) 
-        : m_pool{}, m_queue{&m_pool}
-    {
-        if (size > N) throw std::length_error("queue exceeds static capacity");
-        m_queue.resize(size, val);
-    }
-
-    StaticStdQueue(const StaticStdQueue& other) 
-        : m_pool{}, m_queue{other.m_queue, &m_pool}
-    {}
-
-    StaticStdQueue(StaticStdQueue&& other) noexcept 
-        : m_pool{}, m_queue{std::move(other.m_queue), &m_pool}
-    {}
-
-    ~StaticStdQueue() = default;
-
-    // ----------------------------------------
-    // --- iterators
-    // ----------------------------------------
-    Iterator begin() override { return Iterator(m_queue.begin()); }
-    ConstIterator begin() const override { return ConstIterator(m_queue.cbegin()); }
-    Iterator end() override { return Iterator(m_queue.end()); }
-    ConstIterator end() const override { return ConstIterator(m_queue.cend()); }
 
-    // ----------------------------------------
-    // --- information
-    // ----------------------------------------
-    bool empty() const noexcept override { return m_queue.empty(); }
-    bool full() const noexcept override { return m_queue.size() == N; }
-    size_t size() const noexcept override { return m_queue.size(); }
-    size_t capacity() const noexcept override { return N; }
-    
-    // ----------------------------------------
-    // --- data access
-    // ----------------------------------------
-    ValueType& operator[](const size_t i) noexcept override { return m_queue[i]; }
-    const ValueType& operator[](const size_t i) const noexcept override { return m_queue[i]; }
-    ValueType& at(size_t i) override { return m_queue.at(i); }
-    const ValueType& at(size_t i) const override { return m_queue.at(i); }
+protected:
+    using ConsumeFn = void(*)(void*, ValueType&&);
+    virtual size_t consumeImpl(ConsumeFn fn, void* context, size_t max) = 0;
+};
 
-    std::optional<std::reference_wrapper<const ValueType>> peek() const override
-    { 
-        if (empty()) return std::nullopt;
-        return m_queue.front();
-    }
-    
-    // ----------------------------------------
-    // --- manipulation
-    // ----------------------------------------
-    StaticStdQueue& operator=(const StaticStdQueue& other)
-    {
-        if (this != &other) {
-            m_queue.clear();
-            m_queue.resize(other.m_queue.size());
-            std::ranges::copy(other.m_queue, m_queue.begin());
-        }
-        return *this;
-    }
+namespace detail {
 
-    StaticStdQueue& operator=(StaticStdQueue&& other) noexcept
+    // power of two ring sizes wrap with a mask, others divide by a constant
+    template<size_t N>
+    constexpr size_t wrapRing(const size_t index) noexcept
     {
-        if (this != &other) {
-            m_queue.clear();
-            m_queue.resize(other.m_queue.size());
-            std::ranges::move(other.m_queue, m_queue.begin());
-            other.m_queue.clear();
-        }
-        return *this;
-    }
-
-    virtual void clear() noexcept override { m_queue.clear(); }
-
-    virtual void resize(size_t size) override 
-    { 
-        if (size > N) throw std::length_error("queue exceeds static capacity");
-        m_queue.resize(size); 
-    }
-
-    virtual void resize(size_t size, const ValueType& value) override 
-    { 
-        if (size > N) throw std::length_error("queue exceeds static capacity");
-        m_queue.resize(size, value); 
-    }
-
-    virtual bool push(const ValueType& value) override 
-    { 
-        if constexpr (std::is_copy_constructible_v<ValueType>)
-        {
-            if (full()) return false;
-            m_queue.push_back(value); 
-            return true;
-        }
+        if constexpr (std::has_single_bit(N))
+            return index & (N - 1);
         else
-        {
-            return false;
-        }
-    }
-
-    virtual bool push(ValueType&& value) override 
-    { 
-        if (full()) return false;
-        m_queue.push_back(std::move(value)); 
-        return true; 
-    }
-
-    virtual std::optional<ValueType> pop() override 
-    {  
-        if (empty()) return std::nullopt;
-        ValueType value = std::move(m_queue.front());
-        m_queue.pop_front();
-        return std::move(value);
-    }
-
-    virtual Iterator insert(ConstIterator pos, Iterator first, Iterator last) override 
-    { 
-        const auto copyCount = std::distance(first, last);
-        if (m_queue.size() + copyCount > N) throw std::length_error("Insert would exceed static queue capacity");
-
-        const auto index = std::distance(ConstIterator(begin()), pos);
-        return Iterator(m_queue.insert(begin()+index, first, last));
-    }
-
-    virtual Iterator insert(ConstIterator pos, std::move_iterator<Iterator> first, std::move_iterator<Iterator> last) override 
-    { 
-        const auto copyCount = std::distance(first, last);
-        if (m_queue.size() + copyCount > N) throw std::length_error("Insert would exceed static queue capacity");
-
-        const auto index = std::distance(ConstIterator(begin()), pos);
-        return Iterator(m_queue.insert(begin()+index, first, last));
-    }
-
-    Iterator erase(size_t index) override 
-    {
-        return Iterator(m_queue.erase(m_queue.begin()+index));
-    }
-
-    Iterator erase(size_t index, size_t count) override 
-    {
-        return Iterator(m_queue.erase(m_queue.begin()+index, m_queue.begin()+index+count));
-    }
-
-    Iterator erase(ConstIterator pos) override 
-    {
-        const auto index = std::distance(ConstIterator(begin()), pos);
-        return erase(index);
-    }
-
-    Iterator erase(ConstIterator first, ConstIterator last) override 
-    {
-        const auto index = std::distance(ConstIterator(begin()), first);
-        const auto count = std::distance(first, last);
-        return erase(index, count);
-    }
-
-    template<class... Args>
-    OptionalRef emplace(Args&&... args)
-    {
-        if (full()) return std::nullopt;
-        return std::ref(m_queue.emplace_back(std::forward<Args...>(args...)));
+            return index % N;
     }
 
-private:
-    // ----------------------------------------
-    // --- data
-    // ----------------------------------------
-    StaticDequePool<ValueType, N> m_pool;
-    std::pmr::deque<ValueType> m_queue;
-};
-
-static_assert(std::ranges::random_access_range<StaticStdQueue<int, 5>>);
-static_assert(std::ranges::random_access_range<const StaticStdQueue<int, 5>>);
+}
 
 template<typename T>
 requires std::default_initializable<T>
@@ -404,18 +239,16 @@ public:
         return data()[m_head];
     }
 
+    // the queued elements as the (at most two) contiguous runs of the ring, oldest first
+    std::array<std::span<ValueType>, 2> segments() noexcept { return segmentsRing<0>(); }
+    std::array<std::span<const ValueType>, 2> segments() const noexcept { return segmentsRing<0>(); }
+
     // ----------------------------------------
     // --- manipulation
     // ----------------------------------------
     void clear() noexcept override
     {
-        if (m_head > m_tail) {
-            getStore().destroy(m_tail, capacity()-m_tail);
-            getStore().destroy(0, m_head);
-        } else {
-            getStore().destroy(m_head, m_tail-m_head);
-        }
-        m_size = 0;
+        releaseHead(m_size, std::min(m_size, capacity() - m_head));
         m_head = 0;
         m_tail = 0;
     }
@@ -423,53 +256,31 @@ public:
     void resize(size_t size) override
     {
         if (size > capacity()) throw std::length_error("Initial size exceeds static capacity"); 
-        if (size == m_size) return;
-
-        auto tail = (m_head + size) % capacity();
         if (size > m_size) {
-            if (m_tail > tail) {
-                getStore().construct(m_tail, capacity()-m_tail);
-                getStore().construct(0, tail);
-            } else {
-                getStore().construct(m_tail, tail-m_tail);
-            }
+            const size_t count = size - m_size;
+            const size_t first = std::min(count, capacity() - m_tail);
+            getStore().construct(m_tail, first);
+            getStore().construct(0, count - first);
+            advanceTail(count);
         }
-        else {
-            if (tail > m_tail) {
-                getStore().destroy(tail, capacity()-tail);
-                getStore().destroy(0, m_tail);
-            } else {
-                getStore().destroy(tail, m_tail-tail);
-            }
+        else if (size < m_size) {
+            releaseTail(m_size - size);
         }
-        m_size = size;
-        m_tail = tail;
     }
 
     void resize(size_t size, const ValueType& value) override
     {
         if (size > capacity()) throw std::length_error("Initial size exceeds static capacity"); 
-        if (size == m_size) return;
-
-        auto tail = (m_head + size) % capacity();
         if (size > m_size) {
-            if (m_tail > tail) {
-                getStore().uninitializedFill(m_tail, capacity()-m_tail, value);
-                getStore().uninitializedFill(0, tail, value);
-            } else {
-                getStore().uninitializedFill(m_tail, tail-m_tail, value);
-            }
+            const size_t count = size - m_size;
+            const size_t first = std::min(count, capacity() - m_tail);
+            getStore().uninitializedFill(m_tail, first, value);
+            getStore().uninitializedFill(0, count - first, value);
+            advanceTail(count);
         }
-        else {
-            if (tail > m_tail) {
-                getStore().destroy(tail, capacity()-tail);
-                getStore().destroy(0, m_tail);
-            } else {
-                getStore().destroy(tail, m_tail-tail);
-            }
+        else if (size < m_size) {
+            releaseTail(m_size - size);
         }
-        m_size = size;
-        m_tail = tail;
     }
 
     bool push(const ValueType& value) override
@@ -641,15 +452,184 @@ public:
         return std::ref(*constructed);
     }
 
+    bool pushN(std::span<const ValueType> values) override { return pushNRing<0>(values); }
+    bool pushN(std::move_iterator<ValueType*> first, std::move_iterator<ValueType*> last) override { return pushNRing<0>(first, last); }
+    size_t popN(std::span<ValueType> out) override { return popNRing<0>(out); }
+
+    // segment-wise variant of IQueue::consume, the callback is inlined instead of called through a pointer
+    template<typename Callback>
+    requires std::invocable<Callback, ValueType&&>
+    size_t consume(Callback&& cb, size_t max = std::numeric_limits<size_t>::max())
+    {
+        return consumeRing<0>(std::forward<Callback>(cb), max);
+    }
+
 protected:
     StaticQueueBase() noexcept 
         : m_size{ 0 } , m_head{ 0 }, m_tail{ 0 }
     {}
 
+    size_t consumeImpl(typename Handle::ConsumeFn fn, void* context, size_t max) override
+    {
+        return consume([fn, context](ValueType&& value) { fn(context, std::move(value)); }, max);
+    }
+
+    // ----------------------------------------
+    // --- bulk operations
+    // ----------------------------------------
+    // Capacity 0 asks the store at runtime, StaticQueue passes its own so that the index
+    // arithmetic is neither dispatched virtually nor divided for power of two capacities.
+    template<size_t Capacity>
+    std::array<std::span<ValueType>, 2> segmentsRing() noexcept
+    {
+        const size_t first = std::min(m_size, ringCapacity<Capacity>() - m_head);
+        return { std::span<ValueType>{data() + m_head, first}, std::span<ValueType>{data(), m_size - first} };
+    }
+
+    template<size_t Capacity>
+    std::array<std::span<const ValueType>, 2> segmentsRing() const noexcept
+    {
+        const size_t first = std::min(m_size, ringCapacity<Capacity>() - m_head);
+        return { std::span<const ValueType>{data() + m_head, first}, std::span<const ValueType>{data(), m_size - first} };
+    }
+
+    template<size_t Capacity>
+    bool pushNRing(std::span<const ValueType> values)
+    {
+        if constexpr (std::is_copy_constructible_v<ValueType>) {
+            if (values.size() > ringCapacity<Capacity>() - m_size) return false;
+            const size_t first = std::min(values.size(), ringCapacity<Capacity>() - m_tail);
+            uninitializedCopyRun(values.data(), first, data() + m_tail);
+            uninitializedCopyRun(values.data() + first, values.size() - first, data());
+            advanceTail<Capacity>(values.size());
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    template<size_t Capacity>
+    bool pushNRing(std::move_iterator<ValueType*> first, std::move_iterator<ValueType*> last)
+    {
+        if constexpr (std::is_move_constructible_v<ValueType>) {
+            const size_t count = std::distance(first, last);
+            if (count > ringCapacity<Capacity>() - m_size) return false;
+            const size_t firstRun = std::min(count, ringCapacity<Capacity>() - m_tail);
+            uninitializedMoveRun(first.base(), firstRun, data() + m_tail);
+            uninitializedMoveRun(first.base() + firstRun, count - firstRun, data());
+            advanceTail<Capacity>(count);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    template<size_t Capacity>
+    size_t popNRing(std::span<ValueType> out)
+    {
+        const size_t count = std::min(out.size(), m_size);
+        const size_t first = std::min(count, ringCapacity<Capacity>() - m_head);
+        moveRun(data() + m_head, first, out.data());
+        moveRun(data(), count - first, out.data() + first);
+        releaseHead<Capacity>(count, first);
+        return count;
+    }
+
+    template<size_t Capacity, typename Callback>
+    size_t consumeRing(Callback&& cb, size_t max)
+    {
+        const size_t count = std::min(max, m_size);
+        const size_t first = std::min(count, ringCapacity<Capacity>() - m_head);
+        for (ValueType& value : std::span<ValueType>{data() + m_head, first}) {
+            std::invoke(cb, std::move(value));
+        }
+        for (ValueType& value : std::span<ValueType>{data(), count - first}) {
+            std::invoke(cb, std::move(value));
+        }
+        releaseHead<Capacity>(count, first);
+        return count;
+    }
+
 private:
     constexpr ValueType* data() noexcept { return reinterpret_cast<ValueType*>(getStore().data()); }
     constexpr const ValueType* data() const noexcept { return reinterpret_cast<const ValueType*>(getStore().data()); }
 
+    // trivially copyable elements are transferred with memcpy
+    static void uninitializedCopyRun(const ValueType* src, size_t count, ValueType* dst)
+    {
+        if (count == 0) return;
+        if constexpr (std::is_trivially_copyable_v<ValueType>)
+            std::memcpy(static_cast<void*>(dst), src, count * sizeof(ValueType));
+        else
+            std::uninitialized_copy_n(src, count, dst);
+    }
+
+    static void uninitializedMoveRun(ValueType* src, size_t count, ValueType* dst)
+    {
+        if (count == 0) return;
+        if constexpr (std::is_trivially_copyable_v<ValueType>)
+            std::memcpy(static_cast<void*>(dst), src, count * sizeof(ValueType));
+        else
+            std::uninitialized_move_n(src, count, dst);
+    }
+
+    static void moveRun(ValueType* src, size_t count, ValueType* dst)
+    {
+        if (count == 0) return;
+        if constexpr (std::is_trivially_copyable_v<ValueType>)
+            std::memcpy(static_cast<void*>(dst), src, count * sizeof(ValueType));
+        else
+            std::move(src, src + count, dst);
+    }
+
+    template<size_t Capacity>
+    constexpr size_t ringCapacity() const noexcept
+    {
+        if constexpr (Capacity == 0)
+            return capacity();
+        else
+            return Capacity;
+    }
+
+    template<size_t Capacity>
+    constexpr size_t ringWrap(const size_t index) const noexcept
+    {
+        if constexpr (Capacity == 0)
+            return index % capacity();
+        else
+            return detail::wrapRing<Capacity>(index);
+    }
+
+    template<size_t Capacity = 0>
+    void advanceTail(size_t count)
+    {
+        m_tail = ringWrap<Capacity>(m_tail + count);
+        m_size += count;
+    }
+
+    // destroys the first count elements, first of them are in the run starting at the head
+    template<size_t Capacity = 0>
+    void releaseHead(size_t count, size_t first)
+    {
+        if (first > 0) getStore().destroy(m_head, first);
+        if (count > first) getStore().destroy(0, count - first);
+        m_head = ringWrap<Capacity>(m_head + count);
+        m_size -= count;
+    }
+
+    // destroys the last count elements
+    void releaseTail(size_t count)
+    {
+        const size_t tail = (m_tail + capacity() - count) % capacity();
+        const size_t first = std::min(count, capacity() - tail);
+        if (first > 0) getStore().destroy(tail, first);
+        if (count > first) getStore().destroy(0, count - first);
+        m_tail = tail;
+        m_size -= count;
+    }
+
     virtual StoreType& getStore() = 0;
     virtual const StoreType& getStore() const = 0;
 
@@ -670,7 +650,74 @@ class StaticQueue : public StaticQueueBase<T>
     using ValueType = Base::ValueType;
     using StoreType = Base::StoreType;
 
+    // index based iterator on the ring with the capacity known at compile time,
+    // nothing is dispatched virtually
+    template<bool IsConst>
+    struct FastIterator 
+    {
+        // ----------------------------------------
+        // --- types
+        // ----------------------------------------
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = std::remove_const_t<T>;
+        using pointer           = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference         = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        // ----------------------------------------
+        // --- constructors/destructors
+        // ----------------------------------------
+        constexpr FastIterator() = default;
+        constexpr FastIterator(pointer data, size_t head, size_t index) : data{ data }, head{ head }, index{ index } {}
+        template<bool WasConst>
+        requires(IsConst && !WasConst)
+        constexpr FastIterator(const FastIterator<WasConst>& other) : data{ other.data }, head{ other.head }, index{ other.index } {}
+        ~FastIterator() = default;
+
+        constexpr bool operator==(const FastIterator& other) const { return index == other.index; }
+        constexpr auto operator<=>(const FastIterator& other) const { return index <=> other.index; }
+
+        // ----------------------------------------
+        // --- data access
+        // ----------------------------------------
+        constexpr reference operator*() const { return data[wrap(head + index)]; }
+        constexpr pointer operator->() const { return &data[wrap(head + index)]; }
+        constexpr reference operator[](difference_type n) const { return data[wrap(head + index + n)]; }
+
+        // ----------------------------------------
+        // --- manipulation
+        // ----------------------------------------
+        constexpr FastIterator& operator++() { ++index; return *this; }
+        constexpr FastIterator operator++(int) { FastIterator tmp = *this; ++index; return tmp; }
+        constexpr FastIterator& operator--() { --index; return *this; }
+        constexpr FastIterator operator--(int) { FastIterator tmp = *this; --index; return tmp; }
+        constexpr FastIterator& operator+=(difference_type n) { index += n; return *this; }
+        constexpr FastIterator& operator-=(difference_type n) { index -= n; return *this; }
+
+        friend constexpr FastIterator operator+(FastIterator it, difference_type n) { return (it += n); }
+        friend constexpr FastIterator operator+(difference_type n, FastIterator it) { return (it += n); }
+        friend constexpr FastIterator operator-(FastIterator it, difference_type n) { return (it -= n); }
+        friend constexpr difference_type operator-(const FastIterator& lhs, const FastIterator& rhs) {
+            return static_cast<difference_type>(lhs.index) - static_cast<difference_type>(rhs.index);
+        }
+
+        // ----------------------------------------
+        // --- data
+        // ----------------------------------------
+        pointer data = nullptr;
+        size_t head = 0;
+        size_t index = 0;
+    };
+
 public:
+    using FastView      = std::ranges::subrange<FastIterator<false>>;
+    using ConstFastView = std::ranges::subrange<FastIterator<true>>;
+
+    // power of two capacities wrap with a mask, others divide by a constant
+    static constexpr bool POWER_OF_TWO = std::has_single_bit(N);
+
+    static constexpr size_t wrap(const size_t index) noexcept { return detail::wrapRing<N>(index); }
+
     StaticQueue() noexcept 
         : Base(0, 0, 0)
     {}
@@ -774,15 +821,204 @@ public:
         }
     }
 
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool full() const noexcept override final { return Base::m_size >= N; }
+    constexpr size_t capacity() const noexcept override final { return N; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    ValueType& operator[](size_t index) override final { return data()[wrap(Base::m_head + index)]; }
+    const ValueType& operator[](size_t index) const override final { return data()[wrap(Base::m_head + index)]; }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    bool push(const ValueType& value) override final
+    {
+        if constexpr (std::is_copy_constructible_v<ValueType>) {
+            if (full()) return false;
+            std::construct_at(&data()[Base::m_tail], value);
+            Base::m_tail = wrap(Base::m_tail + 1);
+            Base::m_size++;
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    bool push(ValueType&& value) override final
+    {
+        if constexpr (std::is_move_constructible_v<ValueType>) {
+            if (full()) return false;
+            std::construct_at(&data()[Base::m_tail], std::move(value));
+            Base::m_tail = wrap(Base::m_tail + 1);
+            Base::m_size++;
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    std::optional<ValueType> pop() override final
+    {
+        if (Base::empty()) return std::nullopt;
+        std::optional<ValueType> value = std::move(data()[Base::m_head]);
+        m_store.destroy(Base::m_head, 1);
+        Base::m_head = wrap(Base::m_head + 1);
+        Base::m_size--;
+        return value;
+    }
+
+    bool pushN(std::span<const ValueType> values) override final { return Base::template pushNRing<N>(values); }
+    bool pushN(std::move_iterator<ValueType*> first, std::move_iterator<ValueType*> last) override final { return Base::template pushNRing<N>(first, last); }
+    size_t popN(std::span<ValueType> out) override final { return Base::template popNRing<N>(out); }
+
+    template<typename Callback>
+    requires std::invocable<Callback, ValueType&&>
+    size_t consume(Callback&& cb, size_t max = std::numeric_limits<size_t>::max())
+    {
+        return Base::template consumeRing<N>(std::forward<Callback>(cb), max);
+    }
+
+    std::array<std::span<ValueType>, 2> segments() noexcept { return Base::template segmentsRing<N>(); }
+    std::array<std::span<const ValueType>, 2> segments() const noexcept { return Base::template segmentsRing<N>(); }
+
+    // native iterators for hot loops, begin()/end() dispatch virtually per element
+    constexpr FastView fast() noexcept 
+    { 
+        return { FastIterator<false>{data(), Base::m_head, 0}, FastIterator<false>{data(), Base::m_head, Base::m_size} };
+    }
+
+    constexpr ConstFastView fast() const noexcept 
+    { 
+        return { FastIterator<true>{data(), Base::m_head, 0}, FastIterator<true>{data(), Base::m_head, Base::m_size} };
+    }
+
+protected:
+    constexpr ValueType* data() noexcept { return reinterpret_cast<ValueType*>(m_store.data()); }
+    constexpr const ValueType* data() const noexcept { return reinterpret_cast<const ValueType*>(m_store.data()); }
+
+    StaticObjectStore<ValueType, N, ClearOnDestroy> m_store;
+
+    size_t consumeImpl(typename Base::Handle::ConsumeFn fn, void* context, size_t max) override final
+    {
+        return consume([fn, context](ValueType&& value) { fn(context, std::move(value)); }, max);
+    }
+
 private:
     StoreType& getStore() override { return m_store; }
     const StoreType& getStore() const override { return m_store; }
-
-    StaticObjectStore<ValueType, N, ClearOnDestroy> m_store;
 };
 
 static_assert(std::ranges::random_access_range<StaticQueue<int, 5>>);
 static_assert(std::ranges::random_access_range<const StaticQueue<int, 5>>);
+static_assert(std::random_access_iterator<std::ranges::iterator_t<StaticQueue<int, 5>::FastView>>);
+static_assert(std::random_access_iterator<std::ranges::iterator_t<StaticQueue<int, 5>::ConstFastView>>);
+
+// Ring buffer queue which additionally pushes and pops at the front, every operation at either end is O(1).
+// push()/pop() keep their FIFO meaning, so a deque can be passed wherever an IQueue is expected.
+template<typename T, size_t N, bool ClearOnDestroy = true>
+requires std::default_initializable<T>
+class StaticDeque : public StaticQueue<T, N, ClearOnDestroy>
+{
+    using Queue     = StaticQueue<T, N, ClearOnDestroy>;
+    using Base      = StaticQueueBase<T>;
+    using ValueType = Base::ValueType;
+
+public:
+    using OptionalRef = Base::OptionalRef;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    using Queue::Queue;
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    ValueType& front()
+    {
+        if (Base::empty()) throw std::length_error("deque empty");
+        return Queue::data()[Base::m_head];
+    }
+
+    const ValueType& front() const
+    {
+        if (Base::empty()) throw std::length_error("deque empty");
+        return Queue::data()[Base::m_head];
+    }
+
+    ValueType& back()
+    {
+        if (Base::empty()) throw std::length_error("deque empty");
+        return Queue::data()[Queue::wrap(Base::m_tail + N - 1)];
+    }
+
+    const ValueType& back() const
+    {
+        if (Base::empty()) throw std::length_error("deque empty");
+        return Queue::data()[Queue::wrap(Base::m_tail + N - 1)];
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    bool push_back(const ValueType& value) { return Queue::push(value); }
+    bool push_back(ValueType&& value) { return Queue::push(std::move(value)); }
+
+    bool push_front(const ValueType& value) requires std::is_copy_constructible_v<ValueType>
+    {
+        return emplace_front(value).has_value();
+    }
+
+    bool push_front(ValueType&& value) requires std::is_move_constructible_v<ValueType>
+    {
+        return emplace_front(std::move(value)).has_value();
+    }
+
+    std::optional<ValueType> pop_front() { return Queue::pop(); }
+
+    std::optional<ValueType> pop_back()
+    {
+        if (Base::empty()) return std::nullopt;
+        const size_t index = Queue::wrap(Base::m_tail + N - 1);
+        std::optional<ValueType> value = std::move(Queue::data()[index]);
+        Queue::m_store.destroy(index, 1);
+        Base::m_tail = index;
+        Base::m_size--;
+        return value;
+    }
+
+    template<class... Args>
+    OptionalRef emplace_back(Args&&... args)
+    {
+        return Base::emplace(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    OptionalRef emplace_front(Args&&... args)
+    {
+        if (Queue::full()) return std::nullopt;
+        const size_t index = Queue::wrap(Base::m_head + N - 1);
+        auto constructed = std::construct_at(&Queue::data()[index], std::forward<Args>(args)...);
+        Base::m_head = index;
+        Base::m_size++;
+        return std::ref(*constructed);
+    }
+};
+
+static_assert(std::ranges::random_access_range<StaticDeque<int, 5>>);
+static_assert(std::ranges::random_access_range<const StaticDeque<int, 5>>);
+
+// std::deque cannot be bounded without knowing the block layout of the standard library,
+// the queue is a StaticDeque instead
+template<typename T, size_t N>
+using StaticStdQueue = StaticDeque<T, N>;
 
 template<typename T>
 requires std::default_initializable<T>
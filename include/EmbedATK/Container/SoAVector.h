@@ -0,0 +1,378 @@
+#pragma once
+
+#include "Container.h"
+
+#include "EmbedATK/Core/Core.h"
+
+namespace detail
+{
+    // storage for one member of all elements, starts on its own cache line
+    template<typename T, size_t N>
+    struct alignas(std::max(alignof(T), size_t{EATK_CACHE_LINE_SIZE})) SoAColumn
+    {
+        constexpr T* data() noexcept { return reinterpret_cast<T*>(storage.data()); }
+        constexpr const T* data() const noexcept { return reinterpret_cast<const T*>(storage.data()); }
+
+        std::array<std::byte, sizeof(T) * N> storage;
+    };
+}
+
+//------------------------------------------------------
+//                   SoA Vector
+//------------------------------------------------------
+
+// Vector of aggregates stored as struct of arrays: every member of T lives in its own
+// contiguous column, so loops over a single member only touch that member's cache lines.
+// Members are found with reflect, T has to be an aggregate without base classes.
+// Elements are accessed through proxies, columns as spans:
+//   for (auto& pos : axes.column<Axes::field("actualPosition")>()) ...
+template<typename T, size_t N>
+requires std::is_aggregate_v<T>
+class StaticSoAVector
+{
+    template<size_t I>
+    using MemberType = std::remove_cvref_t<decltype(reflect::get<I>(std::declval<T&>()))>;
+
+    template<typename Seq>
+    struct ColumnsOf;
+
+    template<size_t... I>
+    struct ColumnsOf<std::index_sequence<I...>>
+    {
+        using type = std::tuple<detail::SoAColumn<MemberType<I>, N>...>;
+    };
+
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using ValueType = T;
+
+    static constexpr size_t FIELDS = reflect::size<T>();
+
+    template<size_t I>
+    using FieldType = MemberType<I>;
+
+    // index of the member with the given name, fails to compile for unknown names
+    static consteval size_t field(std::string_view name)
+    {
+        size_t index = FIELDS;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((reflect::member_name<I, T>() == name ? index = I : index), ...);
+        }(std::make_index_sequence<FIELDS>{});
+
+        if (index == FIELDS) throw std::logic_error("no such member");
+        return index;
+    }
+
+    template<bool IsConst>
+    class ReferenceBase
+    {
+    public:
+        using Owner = std::conditional_t<IsConst, const StaticSoAVector, StaticSoAVector>;
+
+        constexpr ReferenceBase(Owner& owner, const size_t index) noexcept : m_owner(&owner), m_index(index) {}
+
+        template<size_t I>
+        constexpr auto& get() const noexcept { return m_owner->template column<I>()[m_index]; }
+
+        constexpr operator ValueType() const { return m_owner->load(m_index); }
+
+        constexpr const ReferenceBase& operator=(const ValueType& value) const requires (!IsConst)
+        {
+            m_owner->store(m_index, value);
+            return *this;
+        }
+
+        constexpr const ReferenceBase& operator=(const ReferenceBase& other) const requires (!IsConst)
+        {
+            m_owner->store(m_index, other.m_owner->load(other.m_index));
+            return *this;
+        }
+
+    private:
+        Owner* m_owner;
+        size_t m_index;
+    };
+
+    using Reference      = ReferenceBase<false>;
+    using ConstReference = ReferenceBase<true>;
+
+    // random access iterator yielding proxies
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept  = std::random_access_iterator_tag;
+        using value_type        = ValueType;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = ReferenceBase<IsConst>;
+        using Owner             = std::conditional_t<IsConst, const StaticSoAVector, StaticSoAVector>;
+
+        constexpr IteratorBase() noexcept = default;
+        constexpr IteratorBase(Owner* owner, const size_t index) noexcept : m_owner(owner), m_index(index) {}
+        template<bool WasConst>
+        requires(IsConst && !WasConst)
+        constexpr IteratorBase(const IteratorBase<WasConst>& other) noexcept : m_owner(other.m_owner), m_index(other.m_index) {}
+
+        constexpr reference operator*() const noexcept { return { *m_owner, m_index }; }
+        constexpr reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+        constexpr IteratorBase& operator++() noexcept { ++m_index; return *this; }
+        constexpr IteratorBase operator++(int) noexcept { auto tmp = *this; ++m_index; return tmp; }
+        constexpr IteratorBase& operator--() noexcept { --m_index; return *this; }
+        constexpr IteratorBase operator--(int) noexcept { auto tmp = *this; --m_index; return tmp; }
+        constexpr IteratorBase& operator+=(const difference_type n) noexcept { m_index += n; return *this; }
+        constexpr IteratorBase& operator-=(const difference_type n) noexcept { m_index -= n; return *this; }
+
+        friend constexpr IteratorBase operator+(IteratorBase it, const difference_type n) noexcept { return it += n; }
+        friend constexpr IteratorBase operator+(const difference_type n, IteratorBase it) noexcept { return it += n; }
+        friend constexpr IteratorBase operator-(IteratorBase it, const difference_type n) noexcept { return it -= n; }
+        friend constexpr difference_type operator-(const IteratorBase& a, const IteratorBase& b) noexcept
+        {
+            return static_cast<difference_type>(a.m_index) - static_cast<difference_type>(b.m_index);
+        }
+
+        friend constexpr bool operator==(const IteratorBase& a, const IteratorBase& b) noexcept { return a.m_index == b.m_index; }
+        friend constexpr auto operator<=>(const IteratorBase& a, const IteratorBase& b) noexcept { return a.m_index <=> b.m_index; }
+
+    private:
+        friend class IteratorBase<true>;
+
+        Owner* m_owner = nullptr;
+        size_t m_index = 0;
+    };
+
+    using Iterator      = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    StaticSoAVector() noexcept : m_size{ 0 } {}
+
+    StaticSoAVector(const StaticSoAVector& other) : m_size{ 0 }
+    {
+        forEachField([&]<size_t I>() {
+            std::uninitialized_copy_n(other.column<I>().data(), other.m_size, column<I>(0).data());
+        });
+        m_size = other.m_size;
+    }
+
+    StaticSoAVector(StaticSoAVector&& other) noexcept : m_size{ 0 }
+    {
+        forEachField([&]<size_t I>() {
+            std::uninitialized_move_n(other.column<I>().data(), other.m_size, column<I>(0).data());
+        });
+        m_size = other.m_size;
+        other.clear();
+    }
+
+    StaticSoAVector(const std::initializer_list<ValueType>& data) : m_size{ 0 }
+    {
+        if (data.size() > N) throw std::length_error("Initial size exceeds static capacity");
+        for (const auto& value : data) {
+            push_back(value);
+        }
+    }
+
+    ~StaticSoAVector()
+    {
+        clear();
+    }
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    constexpr Iterator begin() noexcept { return { this, 0 }; }
+    constexpr ConstIterator begin() const noexcept { return { this, 0 }; }
+    constexpr Iterator end() noexcept { return { this, m_size }; }
+    constexpr ConstIterator end() const noexcept { return { this, m_size }; }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr bool full() const noexcept { return m_size >= N; }
+    constexpr size_t size() const noexcept { return m_size; }
+    constexpr size_t capacity() const noexcept { return N; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    template<size_t I>
+    constexpr std::span<FieldType<I>> column() noexcept { return column<I>(m_size); }
+
+    template<size_t I>
+    constexpr std::span<const FieldType<I>> column() const noexcept
+    {
+        return { std::get<I>(m_columns).data(), m_size };
+    }
+
+    constexpr Reference operator[](const size_t index) noexcept { return { *this, index }; }
+    constexpr ConstReference operator[](const size_t index) const noexcept { return { *this, index }; }
+
+    constexpr Reference at(const size_t index)
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds vector size");
+        return { *this, index };
+    }
+
+    constexpr ConstReference at(const size_t index) const
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds vector size");
+        return { *this, index };
+    }
+
+    constexpr Reference front()
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return { *this, 0 };
+    }
+
+    constexpr ConstReference front() const
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return { *this, 0 };
+    }
+
+    constexpr Reference back()
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return { *this, m_size - 1 };
+    }
+
+    constexpr ConstReference back() const
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return { *this, m_size - 1 };
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    StaticSoAVector& operator=(const StaticSoAVector& other)
+    {
+        if (this != &other) {
+            clear();
+            forEachField([&]<size_t I>() {
+                std::uninitialized_copy_n(other.column<I>().data(), other.m_size, column<I>(0).data());
+            });
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    StaticSoAVector& operator=(StaticSoAVector&& other) noexcept
+    {
+        if (this != &other) {
+            clear();
+            forEachField([&]<size_t I>() {
+                std::uninitialized_move_n(other.column<I>().data(), other.m_size, column<I>(0).data());
+            });
+            m_size = other.m_size;
+            other.clear();
+        }
+        return *this;
+    }
+
+    void clear() noexcept
+    {
+        forEachField([&]<size_t I>() {
+            std::destroy_n(column<I>(0).data(), m_size);
+        });
+        m_size = 0;
+    }
+
+    void resize(const size_t size)
+    {
+        if (size > N) throw std::length_error("vector exceeds static capacity");
+
+        forEachField([&]<size_t I>() {
+            if (size > m_size)
+                std::uninitialized_value_construct_n(column<I>(0).data() + m_size, size - m_size);
+            else
+                std::destroy_n(column<I>(0).data() + size, m_size - size);
+        });
+        m_size = size;
+    }
+
+    void push_back(const ValueType& value)
+    {
+        if (full()) throw std::length_error("vector exceeds static capacity");
+        forEachField([&]<size_t I>() {
+            std::construct_at(column<I>(0).data() + m_size, reflect::get<I>(value));
+        });
+        m_size++;
+    }
+
+    void push_back(ValueType&& value)
+    {
+        if (full()) throw std::length_error("vector exceeds static capacity");
+        forEachField([&]<size_t I>() {
+            std::construct_at(column<I>(0).data() + m_size, std::move(reflect::get<I>(value)));
+        });
+        m_size++;
+    }
+
+    void pop_back()
+    {
+        if (empty()) throw std::length_error("vector empty");
+        m_size--;
+        forEachField([&]<size_t I>() {
+            std::destroy_at(column<I>(0).data() + m_size);
+        });
+    }
+
+    void erase(const size_t index, const size_t count = 1)
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds vector size");
+        const size_t last = std::min(index + count, m_size);
+
+        forEachField([&]<size_t I>() {
+            auto* data = column<I>(0).data();
+            std::move(data + last, data + m_size, data + index);
+            std::destroy(data + m_size - (last - index), data + m_size);
+        });
+        m_size -= last - index;
+    }
+
+private:
+    // ----------------------------------------
+    // --- helpers
+    // ----------------------------------------
+    template<size_t I>
+    constexpr std::span<FieldType<I>> column(const size_t size) noexcept
+    {
+        return { std::get<I>(m_columns).data(), size };
+    }
+
+    template<typename Fn>
+    static constexpr void forEachField(Fn&& fn)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (fn.template operator()<I>(), ...);
+        }(std::make_index_sequence<FIELDS>{});
+    }
+
+    constexpr ValueType load(const size_t index) const
+    {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return ValueType{ column<I>()[index]... };
+        }(std::make_index_sequence<FIELDS>{});
+    }
+
+    constexpr void store(const size_t index, const ValueType& value)
+    {
+        forEachField([&]<size_t I>() {
+            column<I>()[index] = reflect::get<I>(value);
+        });
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    typename ColumnsOf<std::make_index_sequence<FIELDS>>::type m_columns;
+    size_t m_size;
+};
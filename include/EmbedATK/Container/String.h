@@ -0,0 +1,220 @@
+#pragma once
+
+#if __has_include(<format>)
+    #include <format>
+#endif
+
+//------------------------------------------------------
+//                    Static String
+//------------------------------------------------------
+
+// String with an inline buffer of N characters (plus terminator), never allocates.
+// Behaves like a string_view of its contents, appending beyond the capacity throws
+// like the other static containers; formatTo() instead cuts the text off.
+template<size_t N>
+class StaticString
+{
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using ValueType = char;
+    using value_type = char;    // for std::back_inserter
+
+    using Iterator      = char*;
+    using ConstIterator = const char*;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    constexpr StaticString() noexcept : m_data{}, m_size{ 0 } {}
+
+    constexpr StaticString(std::string_view str) : StaticString()
+    {
+        append(str);
+    }
+
+    constexpr StaticString(const char* str) : StaticString(std::string_view{ str }) {}
+
+    template<size_t M>
+    constexpr StaticString(const StaticString<M>& other) : StaticString(other.view()) {}
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    constexpr Iterator begin() noexcept { return m_data.data(); }
+    constexpr ConstIterator begin() const noexcept { return m_data.data(); }
+    constexpr Iterator end() noexcept { return m_data.data() + m_size; }
+    constexpr ConstIterator end() const noexcept { return m_data.data() + m_size; }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr bool full() const noexcept { return m_size >= N; }
+    constexpr size_t size() const noexcept { return m_size; }
+    constexpr size_t length() const noexcept { return m_size; }
+    constexpr size_t capacity() const noexcept { return N; }
+    constexpr size_t available() const noexcept { return N - m_size; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    constexpr char* data() noexcept { return m_data.data(); }
+    constexpr const char* data() const noexcept { return m_data.data(); }
+    constexpr const char* c_str() const noexcept { return m_data.data(); }
+
+    constexpr std::string_view view() const noexcept { return { m_data.data(), m_size }; }
+    constexpr operator std::string_view() const noexcept { return view(); }
+
+    constexpr bool contains(std::string_view str) const noexcept { return view().contains(str); }
+    constexpr bool starts_with(std::string_view str) const noexcept { return view().starts_with(str); }
+    constexpr bool ends_with(std::string_view str) const noexcept { return view().ends_with(str); }
+
+    constexpr char& operator[](const size_t index) noexcept { return m_data[index]; }
+    constexpr const char& operator[](const size_t index) const noexcept { return m_data[index]; }
+
+    constexpr char& at(const size_t index)
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds string size");
+        return m_data[index];
+    }
+
+    constexpr const char& at(const size_t index) const
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds string size");
+        return m_data[index];
+    }
+
+    constexpr char& front()
+    {
+        if (empty()) throw std::length_error("string empty");
+        return m_data[0];
+    }
+
+    constexpr const char& front() const
+    {
+        if (empty()) throw std::length_error("string empty");
+        return m_data[0];
+    }
+
+    constexpr char& back()
+    {
+        if (empty()) throw std::length_error("string empty");
+        return m_data[m_size - 1];
+    }
+
+    constexpr const char& back() const
+    {
+        if (empty()) throw std::length_error("string empty");
+        return m_data[m_size - 1];
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    constexpr void clear() noexcept
+    {
+        m_size = 0;
+        m_data[0] = '\0';
+    }
+
+    constexpr void resize(const size_t size, const char c = '\0')
+    {
+        if (size > N) throw std::length_error("string exceeds static capacity");
+        if (size > m_size)
+            std::fill(m_data.data() + m_size, m_data.data() + size, c);
+        setSize(size);
+    }
+
+    constexpr void assign(std::string_view str)
+    {
+        if (str.size() > N) throw std::length_error("string exceeds static capacity");
+        std::copy(str.begin(), str.end(), m_data.data());
+        setSize(str.size());
+    }
+
+    constexpr void push_back(const char c)
+    {
+        if (full()) throw std::length_error("string exceeds static capacity");
+        m_data[m_size] = c;
+        setSize(m_size + 1);
+    }
+
+    constexpr void pop_back()
+    {
+        if (empty()) throw std::length_error("string empty");
+        setSize(m_size - 1);
+    }
+
+    constexpr StaticString& append(std::string_view str)
+    {
+        if (str.size() > available()) throw std::length_error("string exceeds static capacity");
+        std::copy(str.begin(), str.end(), m_data.data() + m_size);
+        setSize(m_size + str.size());
+        return *this;
+    }
+
+    constexpr StaticString& operator+=(std::string_view str) { return append(str); }
+    constexpr StaticString& operator+=(const char c) { push_back(c); return *this; }
+
+    // makes characters written directly into data() part of the string, e.g. by format_to_n
+    constexpr void commit(const size_t count)
+    {
+        if (count > available()) throw std::length_error("string exceeds static capacity");
+        setSize(m_size + count);
+    }
+
+    // ----------------------------------------
+    // --- comparison
+    // ----------------------------------------
+    friend constexpr bool operator==(const StaticString& lhs, std::string_view rhs) noexcept { return lhs.view() == rhs; }
+    friend constexpr auto operator<=>(const StaticString& lhs, std::string_view rhs) noexcept { return lhs.view() <=> rhs; }
+
+private:
+    constexpr void setSize(const size_t size) noexcept
+    {
+        m_size = size;
+        m_data[m_size] = '\0';
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    std::array<char, N + 1> m_data;
+    size_t m_size;
+};
+
+#if defined(__cpp_lib_format)
+
+    // appends the formatted text, cut off at the capacity of out;
+    // returns false if the text did not fit completely
+    template<size_t N, typename... Args>
+    bool formatTo(StaticString<N>& out, std::format_string<Args...> fmt, Args&&... args)
+    {
+        const size_t available = out.available();
+        const auto result = std::format_to_n(out.end(), static_cast<std::ptrdiff_t>(available), fmt, std::forward<Args>(args)...);
+        const size_t size = static_cast<size_t>(result.size);
+        out.commit(std::min(size, available));
+        return size <= available;
+    }
+
+    // auto name = staticFormat<16>("axis{}", index);
+    template<size_t N, typename... Args>
+    StaticString<N> staticFormat(std::format_string<Args...> fmt, Args&&... args)
+    {
+        StaticString<N> out;
+        formatTo(out, fmt, std::forward<Args>(args)...);
+        return out;
+    }
+
+    template<size_t N>
+    struct std::formatter<StaticString<N>, char> : std::formatter<std::string_view, char>
+    {
+        auto format(const StaticString<N>& str, std::format_context& ctx) const
+        {
+            return std::formatter<std::string_view, char>::format(str.view(), ctx);
+        }
+    };
+
+#endif
@@ -117,6 +117,10 @@ public:
     Iterator end() override { return Iterator(m_vector.end()); }
     ConstIterator end() const override { return ConstIterator(m_vector.cend()); }
 
+    // native iterators for hot loops, begin()/end() dispatch virtually per element
+    std::span<ValueType> fast() noexcept { return { m_vector.data(), m_vector.size() }; }
+    std::span<const ValueType> fast() const noexcept { return { m_vector.data(), m_vector.size() }; }
+
     // ----------------------------------------
     // --- information
     // ----------------------------------------
@@ -284,6 +288,10 @@ public:
     constexpr Iterator end() override { return Iterator(std::span<T>{data(), m_size}.end()); }
     constexpr ConstIterator end() const override { return ConstIterator(std::span<const T>{data(), m_size}.end()); }
 
+    // native iterators for hot loops, begin()/end() dispatch virtually per element
+    constexpr std::span<ValueType> fast() noexcept { return { reinterpret_cast<ValueType*>(m_store.data()), m_size }; }
+    constexpr std::span<const ValueType> fast() const noexcept { return { reinterpret_cast<const ValueType*>(m_store.data()), m_size }; }
+
     // ----------------------------------------
     // --- information
     // ----------------------------------------
@@ -472,4 +480,337 @@ private:
 };
 
 static_assert(std::ranges::random_access_range<StaticVector<int, 5>>);
-static_assert(std::ranges::random_access_range<const StaticVector<int, 5>>);
\ No newline at end of file
+static_assert(std::ranges::random_access_range<const StaticVector<int, 5>>);
+
+// Vector that keeps the first InlineN elements in place and spills to a pool beyond that.
+// The spilled buffer grows geometrically, so a vector that is usually small never allocates
+// and a rare burst still fits. Without a pool it behaves like a StaticVector<T, InlineN>.
+// Spilled memory is handed back to the pool on growth, shrink_to_fit() and destruction.
+template<typename T, size_t InlineN>
+class HybridVector : public IVector<T>
+{
+    static_assert(InlineN > 0, "hybrid vector needs inline capacity");
+    static_assert(std::is_same<typename std::remove_cv<T>::type, T>::value,
+	  "HybridVector must have a non-const, non-volatile value_type");
+
+public:
+    // ----------------------------------------
+    // --- types
+    // ----------------------------------------
+    using Handle                = IVector<T>;
+    using ValueType             = Handle::ValueType;
+    using Iterator              = Handle::Iterator;
+    using ConstIterator         = Handle::ConstIterator;
+
+    static constexpr size_t GROWTH_FACTOR = 2;
+
+    // ----------------------------------------
+    // --- constructors/destructors
+    // ----------------------------------------
+    HybridVector() noexcept = default;
+    explicit HybridVector(IPool& pool) noexcept : m_pool{ &pool } {}
+
+    HybridVector(const size_t size)
+    {
+        resize(size);
+    }
+
+    HybridVector(const size_t size, const ValueType& value)
+    {
+        resize(size, value);
+    }
+
+    HybridVector(const std::initializer_list<ValueType>& data)
+    {
+        if (data.size() > InlineN) throw std::length_error("Initial size exceeds static capacity");
+        std::uninitialized_copy(data.begin(), data.end(), m_data);
+        m_size = data.size();
+    }
+
+    // the copy spills to the same pool as the original
+    HybridVector(const HybridVector& other) : m_pool{ other.m_pool }
+    {
+        reserve(other.m_size);
+        std::uninitialized_copy_n(other.m_data, other.m_size, m_data);
+        m_size = other.m_size;
+    }
+
+    HybridVector(HybridVector&& other) noexcept : m_pool{ other.m_pool }
+    {
+        take(std::move(other));
+    }
+
+    ~HybridVector()
+    {
+        clear();
+        release();
+    }
+
+    // ----------------------------------------
+    // --- iterators
+    // ----------------------------------------
+    constexpr Iterator begin() override { return Iterator(std::span<T>{m_data, m_size}.begin()); }
+    constexpr ConstIterator begin() const override { return ConstIterator(std::span<const T>{m_data, m_size}.begin()); }
+    constexpr Iterator end() override { return Iterator(std::span<T>{m_data, m_size}.end()); }
+    constexpr ConstIterator end() const override { return ConstIterator(std::span<const T>{m_data, m_size}.end()); }
+
+    // native iterators for hot loops, begin()/end() dispatch virtually per element
+    constexpr std::span<ValueType> fast() noexcept { return { m_data, m_size }; }
+    constexpr std::span<const ValueType> fast() const noexcept { return { m_data, m_size }; }
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    constexpr bool empty() const noexcept override { return m_size == 0; }
+    constexpr bool full() const noexcept override { return m_size >= m_capacity && !m_pool; }
+    constexpr size_t size() const noexcept override { return m_size; }
+    constexpr size_t capacity() const noexcept override { return m_capacity; }
+    constexpr bool spilled() const noexcept { return m_data != inlineData(); }
+    constexpr IPool* pool() const noexcept { return m_pool; }
+
+    // ----------------------------------------
+    // --- data access
+    // ----------------------------------------
+    constexpr ValueType* data() noexcept override { return m_data; }
+    constexpr const ValueType* data() const noexcept override { return m_data; }
+    constexpr ValueType& operator[](const size_t index) noexcept override { return m_data[index]; }
+    constexpr const ValueType& operator[](const size_t index) const noexcept override { return m_data[index]; }
+    constexpr ValueType& front() override
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return m_data[0];
+    }
+    constexpr const ValueType& front() const override
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return m_data[0];
+    }
+    constexpr ValueType& back() override
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return m_data[m_size - 1];
+    }
+    constexpr const ValueType& back() const override
+    {
+        if (empty()) throw std::length_error("vector empty");
+        return m_data[m_size - 1];
+    }
+
+    constexpr ValueType& at(size_t index) override
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds vector size");
+        return m_data[index];
+    }
+
+    constexpr const ValueType& at(size_t index) const override
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds vector size");
+        return m_data[index];
+    }
+
+    // ----------------------------------------
+    // --- manipulation
+    // ----------------------------------------
+    HybridVector& operator=(const HybridVector& other)
+    {
+        if (this != &other) {
+            clear();
+            reserve(other.m_size);
+            std::uninitialized_copy_n(other.m_data, other.m_size, m_data);
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    // takes over the pool of other together with its spilled buffer
+    HybridVector& operator=(HybridVector&& other) noexcept
+    {
+        if (this != &other) {
+            clear();
+            release();
+            m_pool = other.m_pool;
+            take(std::move(other));
+        }
+        return *this;
+    }
+
+    void clear() noexcept override
+    {
+        std::destroy_n(m_data, m_size);
+        m_size = 0;
+    }
+
+    void reserve(const size_t capacity)
+    {
+        if (capacity > m_capacity) {
+            reallocate(capacity);
+        }
+    }
+
+    // moves the elements back inline if they fit and returns the spilled buffer to the pool
+    void shrink_to_fit()
+    {
+        if (spilled() && m_size <= InlineN) {
+            T* spill = m_data;
+            std::uninitialized_move_n(spill, m_size, inlineData());
+            std::destroy_n(spill, m_size);
+            m_pool->deallocate(spill, m_capacity * sizeof(T), alignof(T));
+            m_data = inlineData();
+            m_capacity = InlineN;
+        }
+    }
+
+    void resize(const size_t size) override
+    {
+        if (size > m_size) {
+            reserve(size);
+            std::uninitialized_value_construct_n(m_data + m_size, size - m_size);
+        }
+        else {
+            std::destroy_n(m_data + size, m_size - size);
+        }
+        m_size = size;
+    }
+
+    void resize(const size_t size, const ValueType& value) override
+    {
+        if (size > m_size) {
+            reserve(size);
+            std::uninitialized_fill_n(m_data + m_size, size - m_size, value);
+        }
+        else {
+            std::destroy_n(m_data + size, m_size - size);
+        }
+        m_size = size;
+    }
+
+    void push_back(const ValueType& value) override { emplace_back(value); }
+    void push_back(ValueType&& value) override { emplace_back(std::move(value)); }
+
+    void pop_back()
+    {
+        if (empty()) throw std::length_error("vector empty");
+        std::destroy_at(m_data + --m_size);
+    }
+
+    Iterator erase(size_t index) override
+    {
+        return erase(index, 1);
+    }
+
+    Iterator erase(size_t index, size_t count) override
+    {
+        if (index >= m_size) throw std::out_of_range("index exceeds vector size");
+        count = std::min(count, m_size - index);
+        std::move(m_data + index + count, m_data + m_size, m_data + index);
+        std::destroy_n(m_data + m_size - count, count);
+        m_size -= count;
+        auto it = begin();
+        std::advance(it, index);
+        return it;
+    }
+
+    Iterator erase(ConstIterator pos) override
+    {
+        const auto index = std::distance(ConstIterator(begin()), pos);
+        return erase(index);
+    }
+
+    Iterator erase(ConstIterator first, ConstIterator last) override
+    {
+        const auto index = std::distance(ConstIterator(begin()), first);
+        const auto count = std::distance(first, last);
+        return erase(index, count);
+    }
+
+    template<class... Args>
+    ValueType& emplace_back(Args&&... args)
+    {
+        if (m_size < m_capacity) [[likely]] {
+            std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            return m_data[m_size++];
+        }
+
+        // the new element is constructed before the old ones are moved, args may refer to them
+        const size_t capacity = grownCapacity(m_size + 1);
+        T* spill = allocate(capacity);
+        try {
+            std::construct_at(spill + m_size, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            m_pool->deallocate(spill, capacity * sizeof(T), alignof(T));
+            throw;
+        }
+        adopt(spill, capacity);
+        return m_data[m_size++];
+    }
+
+private:
+    // ----------------------------------------
+    // --- helpers
+    // ----------------------------------------
+    constexpr T* inlineData() noexcept { return reinterpret_cast<T*>(m_inline.data()); }
+    constexpr const T* inlineData() const noexcept { return reinterpret_cast<const T*>(m_inline.data()); }
+
+    size_t grownCapacity(const size_t required) const noexcept
+    {
+        return std::max(required, m_capacity * GROWTH_FACTOR);
+    }
+
+    T* allocate(const size_t capacity)
+    {
+        if (!m_pool) throw std::length_error("vector exceeds static capacity");
+        return static_cast<T*>(m_pool->allocate(capacity * sizeof(T), alignof(T)));
+    }
+
+    void reallocate(const size_t capacity)
+    {
+        adopt(allocate(capacity), capacity);
+    }
+
+    // moves the elements into the new buffer and releases the old one
+    void adopt(T* data, const size_t capacity) noexcept
+    {
+        std::uninitialized_move_n(m_data, m_size, data);
+        std::destroy_n(m_data, m_size);
+        release();
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    void release() noexcept
+    {
+        if (spilled()) {
+            m_pool->deallocate(m_data, m_capacity * sizeof(T), alignof(T));
+            m_data = inlineData();
+            m_capacity = InlineN;
+        }
+    }
+
+    // expects this to be empty and not spilled
+    void take(HybridVector&& other) noexcept
+    {
+        if (other.spilled()) {
+            m_data = std::exchange(other.m_data, other.inlineData());
+            m_capacity = std::exchange(other.m_capacity, InlineN);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        else {
+            std::uninitialized_move_n(other.m_data, other.m_size, m_data);
+            m_size = other.m_size;
+            other.clear();
+        }
+    }
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    alignas(T) std::array<std::byte, sizeof(T) * InlineN> m_inline;
+    T* m_data = inlineData();
+    size_t m_size = 0;
+    size_t m_capacity = InlineN;
+    IPool* m_pool = nullptr;
+};
+
+static_assert(std::ranges::random_access_range<HybridVector<int, 5>>);
+static_assert(std::ranges::random_access_range<const HybridVector<int, 5>>);
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "EmbedATK/Core/Core.h"
+
+//------------------------------------------------------
+//                 Work-stealing Deque
+//------------------------------------------------------
+
+// Bounded Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+// The owning thread pushes and pops at the bottom like a stack, any other thread steals from
+// the top in FIFO order. Only the last element is contended, everything else is wait-free.
+// T is copied in and out of the ring as a whole, so it has to be small and trivially copyable
+// (typically a pointer to the actual work item).
+template<typename T, size_t N>
+class StaticWorkStealingDeque
+{
+    static_assert(std::has_single_bit(N), "work-stealing deque capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T> && std::atomic<T>::is_always_lock_free);
+
+    // positions only ever grow, differences are taken modulo 2^bits so wrap around is harmless
+    using Difference = std::make_signed_t<size_t>;
+
+public:
+    using ValueType = T;
+
+    StaticWorkStealingDeque() = default;
+    StaticWorkStealingDeque(const StaticWorkStealingDeque&) = delete;
+    StaticWorkStealingDeque& operator=(const StaticWorkStealingDeque&) = delete;
+
+    // ----------------------------------------
+    // --- information
+    // ----------------------------------------
+    // snapshots while other threads are active
+    bool empty() const noexcept { return size() == 0; }
+    size_t size() const noexcept
+    {
+        const size_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const size_t top = m_top.load(std::memory_order_relaxed);
+        const auto diff = static_cast<Difference>(bottom - top);
+        return diff > 0 ? static_cast<size_t>(diff) : 0;
+    }
+
+    constexpr size_t capacity() const noexcept { return N; }
+
+    // ----------------------------------------
+    // --- owner
+    // ----------------------------------------
+    bool push(const ValueType value) noexcept
+    {
+        const size_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const size_t top = m_top.load(std::memory_order_acquire);
+        if (static_cast<Difference>(bottom - top) >= static_cast<Difference>(N))
+            return false;
+
+        m_buffer[bottom & MASK].store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::optional<ValueType> pop() noexcept
+    {
+        const size_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        size_t top = m_top.load(std::memory_order_relaxed);
+
+        if (static_cast<Difference>(bottom - top) < 0) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<ValueType> value = m_buffer[bottom & MASK].load(std::memory_order_relaxed);
+        if (bottom == top) {
+            // last element, race the thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                value.reset();
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    // ----------------------------------------
+    // --- thieves
+    // ----------------------------------------
+    // fails spuriously if another thread took the same element meanwhile
+    std::optional<ValueType> steal() noexcept
+    {
+        size_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const size_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (static_cast<Difference>(bottom - top) <= 0)
+            return std::nullopt;
+
+        const ValueType value = m_buffer[top & MASK].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return std::nullopt;
+        return value;
+    }
+
+private:
+    static constexpr size_t MASK = N - 1;
+
+    // ----------------------------------------
+    // --- data
+    // ----------------------------------------
+    alignas(EATK_CACHE_LINE_SIZE) std::atomic_size_t m_top = 0;
+    alignas(EATK_CACHE_LINE_SIZE) std::atomic_size_t m_bottom = 0;
+    std::array<std::atomic<ValueType>, N> m_buffer{};
+};
@@ -16,6 +16,12 @@
     #define EATK_PACK_END      
 #endif
 
+#if defined(EATK_PLATFORM_ARM)
+    #define EATK_CACHE_LINE_SIZE 32
+#else
+    #define EATK_CACHE_LINE_SIZE 64
+#endif
+
 //------------------------------------------------------
 //                   Tuple append
 //------------------------------------------------------
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Logger.h"
+
+#include "EmbedATK/Network/NetworkAdapter.h"
+
+#if !defined(EATK_DISABLE_LOGGING) && defined(__cpp_lib_format)
+
+    #if !defined(EATK_LOG_PATH_SIZE)
+        #define EATK_LOG_PATH_SIZE 128
+    #endif
+
+    //------------------------------------------------------
+    //                    File Log Sink
+    //------------------------------------------------------
+
+    // Appends to a file and rotates it once it would grow beyond maxSize:
+    // path -> path.1 -> ... -> path.<maxFiles-1>, the oldest file is removed.
+    // The stream is unbuffered, each batch is handed to the system with a single write.
+    class FileLogSink : public ILogSink
+    {
+    public:
+        FileLogSink(const char* path, const size_t maxSize = 1024*1024, const size_t maxFiles = 3);
+        ~FileLogSink();
+
+        FileLogSink(const FileLogSink&) = delete;
+        FileLogSink& operator=(const FileLogSink&) = delete;
+
+        bool isOpen() const { return m_file != nullptr; }
+        size_t size() const { return m_size; }
+
+        void write(const LogBatch& batch) override;
+
+    private:
+        void open();
+        void rotate();
+
+        std::array<char, EATK_LOG_PATH_SIZE> m_path;
+        size_t m_maxSize;
+        size_t m_maxFiles;
+        size_t m_size = 0;
+        std::FILE* m_file = nullptr;
+    };
+
+    //------------------------------------------------------
+    //                   Memory Log Sink
+    //------------------------------------------------------
+
+    // Keeps the last N bytes of log output in RAM, e.g. to be dumped after a crash.
+    // Place it in a section that survives a reset to read it back after reboot.
+    template<size_t N>
+    class MemoryLogSink : public ILogSink
+    {
+    public:
+        void write(const LogBatch& batch) override
+        {
+            // only the last N bytes of an oversized batch survive anyway
+            std::string_view text = batch.text;
+            if (text.size() > N) {
+                text = text.substr(text.size() - N);
+            }
+
+            const size_t pos = (m_written + batch.text.size() - text.size()) % N;
+            const size_t first = std::min(text.size(), N - pos);
+            std::ranges::copy(text.substr(0, first), m_data.begin() + pos);
+            std::ranges::copy(text.substr(first), m_data.begin());
+            m_written += batch.text.size();
+        }
+
+        // oldest part first, starts at the first complete line once the ring wrapped
+        std::array<std::string_view, 2> contents() const
+        {
+            const std::string_view data{m_data.data(), N};
+            if (m_written <= N)
+                return { data.substr(0, m_written), {} };
+
+            const size_t pos = m_written % N;
+            std::array<std::string_view, 2> parts{ data.substr(pos), data.substr(0, pos) };
+            const size_t lineEnd = parts[0].find('\n');
+            if (lineEnd != std::string_view::npos) {
+                parts[0].remove_prefix(lineEnd + 1);
+            }
+            else {
+                parts[0] = {};
+                parts[1].remove_prefix(std::min(parts[1].find('\n') + 1, parts[1].size()));
+            }
+            return parts;
+        }
+
+        void dump() const
+        {
+            const auto parts = contents();
+            OSAL::printv(parts);
+        }
+
+        void clear() { m_written = 0; }
+
+    private:
+        std::array<char, N> m_data;
+        size_t m_written = 0;
+    };
+
+    //------------------------------------------------------
+    //                    Frame Log Sink
+    //------------------------------------------------------
+
+    // Ships log lines as raw ethernet frames over an opened adapter.
+    // Lines are packed into as few frames as possible and only split if a single line
+    // does not fit into one frame.
+    class FrameLogSink : public ILogSink
+    {
+    public:
+        // IEEE 802 local experimental ethertype
+        static constexpr uint16_t ETHER_TYPE = 0x88B5;
+        static constexpr MAC BROADCAST = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+        static constexpr size_t HEADER_SIZE = 14;
+        static constexpr size_t MAX_PAYLOAD = 1500;
+
+        FrameLogSink(const INetworkAdapter& adapter, const uint16_t etherType = ETHER_TYPE, const MAC& destination = BROADCAST);
+
+        size_t framesSent() const { return m_framesSent; }
+        size_t framesFailed() const { return m_framesFailed; }
+
+        void write(const LogBatch& batch) override;
+
+    private:
+        void send(std::string_view payload);
+
+        const INetworkAdapter& m_adapter;
+        std::array<uint8_t, HEADER_SIZE + MAX_PAYLOAD> m_frame;
+        size_t m_framesSent = 0;
+        size_t m_framesFailed = 0;
+    };
+
+#endif
@@ -3,6 +3,8 @@
 #include "EmbedATK/OSAL/OSAL.h"
 
 #include "EmbedATK/Container/Queue.h"
+#include "EmbedATK/Container/Vector.h"
+#include "EmbedATK/Container/String.h"
 
 #include "EmbedATK/Utils/MessageQueue.h"
 #include "EmbedATK/Utils/Thread.h"
@@ -12,152 +14,504 @@
 
 #if !defined(EATK_DISABLE_LOGGING) && defined(__cpp_lib_format)
 
-    #include <regex>
-
     #define EATK_INIT_LOG(prio)                 ILogger::init(prio)
     #define EATK_SHUTDOWN_LOG()                 ILogger::shutdown()
 
-    #define EATK_TRACE_LOC(loc, fmt, ...)       g_logger->trace(true, loc, fmt, ##__VA_ARGS__)
-    #define EATK_INFO_LOC(loc, fmt, ...)        g_logger->info(true, loc, fmt, ##__VA_ARGS__)
-    #define EATK_WARN_LOC(loc, fmt, ...)        g_logger->warn(true, loc, fmt, ##__VA_ARGS__)
-    #define EATK_ERROR_LOC(loc, fmt, ...)       g_logger->error(true, loc, fmt, ##__VA_ARGS__)
-    #define EATK_FATAL_LOC(loc, fmt, ...)       g_logger->fatal(true, loc, fmt, ##__VA_ARGS__)
-    #define EATK_HIGHLIGHT_LOC(loc, fmt, ...)   g_logger->highlight(true, loc, fmt, ##__VA_ARGS__)
-
-    #define EATK_TRACE(fmt, ...)		        g_logger->trace(true, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_INFO(fmt, ...)		            g_logger->info(true, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_WARN(fmt, ...)		            g_logger->warn(true, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_ERROR(fmt, ...)		        g_logger->error(true, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_FATAL(fmt, ...)		        g_logger->fatal(true, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_HIGHLIGHT(fmt, ...)		    g_logger->highlight(true, METHOD_NAME, fmt, ##__VA_ARGS__)
-
-    #define EATK_TRACE_NOW(fmt, ...)	        g_logger->trace(false, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_INFO_NOW(fmt, ...)	            g_logger->info(false, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_WARN_NOW(fmt, ...)	            g_logger->warn(false, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_ERROR_NOW(fmt, ...)	        g_logger->error(false, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_FATAL_NOW(fmt, ...)	        g_logger->fatal(false, METHOD_NAME, fmt, ##__VA_ARGS__)
-    #define EATK_HIGHLIGHT_NOW(fmt, ...)	    g_logger->highlight(false, METHOD_NAME, fmt, ##__VA_ARGS__)
-
-    #if defined(__cpp_lib_source_location)
-        [[maybe_unused]] 
-        static std::string functionToLocation(const std::string& func)
-        {
-            std::smatch match;
-            if (std::regex_search(func, match, std::regex(R"((?:\b(\w+)\b::)?\b(\w+)\b(?=\s*\())"))) {
-                if (match[1].matched) {
-                    return match[1].str() + "::" + match[2].str();
+    // call sites below this level are removed at compile time (0 = Trace ... 5 = Highlight)
+    #if !defined(EATK_LOG_MIN_LEVEL)
+        #define EATK_LOG_MIN_LEVEL 0
+    #endif
+
+    // Every expansion interns one constexpr LogSite, the record only refers to it.
+    // The runtime level of the site's module is checked before any argument is evaluated.
+    #define EATK_LOG(background, site, fmt, ...) \
+        do { \
+            static constexpr LogSite eatkLogSite site; \
+            if constexpr (static_cast<int>(eatkLogSite.level) >= EATK_LOG_MIN_LEVEL) { \
+                static constinit LogSiteLevel eatkLogSiteLevel; \
+                if (g_logger->enabled(eatkLogSite, eatkLogSiteLevel)) \
+                    g_logger->log(eatkLogSite, background, fmt, ##__VA_ARGS__); \
+            } \
+        } while (false)
+
+    #define EATK_LOG_SITE(level)                {level, std::source_location::current()}
+    #define EATK_LOG_SITE_LOC(level, loc)       {level, loc, std::source_location::current()}
+
+    #define EATK_TRACE_LOC(loc, fmt, ...)       EATK_LOG(true, EATK_LOG_SITE_LOC(LogLevel::Trace, loc), fmt, ##__VA_ARGS__)
+    #define EATK_INFO_LOC(loc, fmt, ...)        EATK_LOG(true, EATK_LOG_SITE_LOC(LogLevel::Info, loc), fmt, ##__VA_ARGS__)
+    #define EATK_WARN_LOC(loc, fmt, ...)        EATK_LOG(true, EATK_LOG_SITE_LOC(LogLevel::Warn, loc), fmt, ##__VA_ARGS__)
+    #define EATK_ERROR_LOC(loc, fmt, ...)       EATK_LOG(true, EATK_LOG_SITE_LOC(LogLevel::Error, loc), fmt, ##__VA_ARGS__)
+    #define EATK_FATAL_LOC(loc, fmt, ...)       EATK_LOG(true, EATK_LOG_SITE_LOC(LogLevel::Fatal, loc), fmt, ##__VA_ARGS__)
+    #define EATK_HIGHLIGHT_LOC(loc, fmt, ...)   EATK_LOG(true, EATK_LOG_SITE_LOC(LogLevel::Highlight, loc), fmt, ##__VA_ARGS__)
+
+    #define EATK_TRACE(fmt, ...)		        EATK_LOG(true, EATK_LOG_SITE(LogLevel::Trace), fmt, ##__VA_ARGS__)
+    #define EATK_INFO(fmt, ...)		            EATK_LOG(true, EATK_LOG_SITE(LogLevel::Info), fmt, ##__VA_ARGS__)
+    #define EATK_WARN(fmt, ...)		            EATK_LOG(true, EATK_LOG_SITE(LogLevel::Warn), fmt, ##__VA_ARGS__)
+    #define EATK_ERROR(fmt, ...)		        EATK_LOG(true, EATK_LOG_SITE(LogLevel::Error), fmt, ##__VA_ARGS__)
+    #define EATK_FATAL(fmt, ...)		        EATK_LOG(true, EATK_LOG_SITE(LogLevel::Fatal), fmt, ##__VA_ARGS__)
+    #define EATK_HIGHLIGHT(fmt, ...)		    EATK_LOG(true, EATK_LOG_SITE(LogLevel::Highlight), fmt, ##__VA_ARGS__)
+
+    #define EATK_TRACE_NOW(fmt, ...)	        EATK_LOG(false, EATK_LOG_SITE(LogLevel::Trace), fmt, ##__VA_ARGS__)
+    #define EATK_INFO_NOW(fmt, ...)	            EATK_LOG(false, EATK_LOG_SITE(LogLevel::Info), fmt, ##__VA_ARGS__)
+    #define EATK_WARN_NOW(fmt, ...)	            EATK_LOG(false, EATK_LOG_SITE(LogLevel::Warn), fmt, ##__VA_ARGS__)
+    #define EATK_ERROR_NOW(fmt, ...)	        EATK_LOG(false, EATK_LOG_SITE(LogLevel::Error), fmt, ##__VA_ARGS__)
+    #define EATK_FATAL_NOW(fmt, ...)	        EATK_LOG(false, EATK_LOG_SITE(LogLevel::Fatal), fmt, ##__VA_ARGS__)
+    #define EATK_HIGHLIGHT_NOW(fmt, ...)	    EATK_LOG(false, EATK_LOG_SITE(LogLevel::Highlight), fmt, ##__VA_ARGS__)
+
+    // size of the inline argument buffer of one log record
+    #if !defined(EATK_LOG_ARGS_SIZE)
+        #if defined(EATK_PLATFORM_ARM)
+            #define EATK_LOG_ARGS_SIZE 48
+        #else
+            #define EATK_LOG_ARGS_SIZE 128
+        #endif
+    #endif
+
+    // maximum length of a line written by the *_NOW macros, longer messages are cut off
+    #if !defined(EATK_LOG_LINE_SIZE)
+        #if defined(EATK_PLATFORM_ARM)
+            #define EATK_LOG_LINE_SIZE 128
+        #else
+            #define EATK_LOG_LINE_SIZE 256
+        #endif
+    #endif
+
+    // number of sinks a logger can write to at the same time
+    #if !defined(EATK_LOG_MAX_SINKS)
+        #define EATK_LOG_MAX_SINKS 4
+    #endif
+
+    // number of modules with their own runtime level and the maximum length of their names
+    #if !defined(EATK_LOG_MAX_MODULES)
+        #define EATK_LOG_MAX_MODULES 16
+    #endif
+    #if !defined(EATK_LOG_MODULE_NAME_SIZE)
+        #define EATK_LOG_MODULE_NAME_SIZE 32
+    #endif
+
+    enum class LogLevel 
+    {
+        Trace = 0,
+        Info,
+        Warn,
+        Error,
+        Fatal,
+        Highlight,
+        Abort = 99
+    };
+
+    // Extracts "Class::method" from a source_location::function_name() at compile time.
+    // The result is a view into the function name itself, so it lives in static storage.
+    consteval std::string_view functionToLocation(std::string_view func)
+    {
+        constexpr auto isIdentifier = [](const char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '~';
+        };
+
+        // skips an identifier and an optional template argument list backwards from end
+        constexpr auto skipName = [isIdentifier](std::string_view str, size_t end) {
+            if (end > 0 && str[end - 1] == '>') {
+                size_t depth = 0;
+                while (end > 0) {
+                    const char c = str[--end];
+                    if (c == '>') ++depth;
+                    else if (c == '<' && --depth == 0) break;
                 }
-                else {
-                    return match[2].str();
+            }
+            while (end > 0 && isIdentifier(str[end - 1])) --end;
+            return end;
+        };
+
+        size_t end = func.find('(');
+        if (end == std::string_view::npos)
+            return func;
+        while (end > 0 && func[end - 1] == ' ') --end;
+
+        const size_t method = skipName(func, end);
+        if (method == end)
+            return func.substr(0, end);
+        if (method < 2 || func.substr(method - 2, 2) != "::")
+            return func.substr(method, end - method);
+
+        const size_t scope = skipName(func, method - 2);
+        return scope == method - 2 ? func.substr(method, end - method) : func.substr(scope, end - scope);
+    }
+
+    // Interned descriptor of one log call site, created at compile time once per macro expansion.
+    struct LogSite
+    {
+        consteval LogSite(const LogLevel level, const std::source_location& source)
+            : level(level), file(source.file_name()), line(source.line()), location(functionToLocation(source.function_name())) {}
+
+        consteval LogSite(const LogLevel level, const std::string_view location, const std::source_location& source)
+            : level(level), file(source.file_name()), line(source.line()), location(location) {}
+
+        LogLevel level;
+        std::string_view file;
+        uint_least32_t line;
+        std::string_view location;
+    };
+
+    // Opt-in for arguments that are copied into a record as raw bytes and formatted later by the
+    // logging thread, besides arithmetic and enum types. Only for trivially copyable types that
+    // have a std::formatter and do not refer to memory outside of themselves.
+    //   template<> struct is_deferrable_log_arg<Vec3> : std::true_type {};
+    template<typename T>
+    struct is_deferrable_log_arg : std::false_type {};
+
+    template<typename T>
+    inline constexpr bool is_deferrable_log_arg_v = is_deferrable_log_arg<T>::value;
+
+    // Runtime level of one call site as seen at a certain configuration generation,
+    // so the module lookup only runs again after the levels were changed.
+    struct LogSiteLevel
+    {
+        std::atomic_uint32_t cache = 0;
+    };
+
+    // What a producer does when the logger queue is full (or under pressure for Sample).
+    enum class LogOverflowPolicy
+    {
+        DropNewest,     // the new message is discarded
+        DropOldest,     // the oldest queued message is discarded to make room, the new one while the logging thread renders
+        Block,          // the producer waits up to a timeout for room, then drops
+        Sample          // above 3/4 fill level only every N-th message is queued
+    };
+
+    struct LogStats
+    {
+        size_t enqueued;
+        size_t dropped;
+        size_t highWater;   // highest observed fill level of the queue
+    };
+
+    // One rendered log line, the views point into the text of the batch it belongs to.
+    struct LogRecord
+    {
+        const LogSite* site;
+        Timestamp ts;
+        std::string_view line;      // "[time] <location>: message" without line break
+        std::string_view message;
+    };
+
+    // All records drained by one wakeup of the logging thread.
+    // text holds the lines back to back, each terminated by '\n'.
+    struct LogBatch
+    {
+        std::string_view text;
+        std::span<const LogRecord> records;
+    };
+
+    class ILogSink
+    {
+    public:
+        virtual ~ILogSink() = default;
+
+        // called once per batch from the logging thread, or from the caller of an *_NOW macro
+        virtual void write(const LogBatch& batch) = 0;
+    };
+
+    // Default sink, writes a whole batch to the console with one gather write per stream.
+    class ConsoleLogSink : public ILogSink
+    {
+    public:
+        ConsoleLogSink(const bool colored = true)
+            : m_colored(colored) {}
+
+        void write(const LogBatch& batch) override
+        {
+            // color, line and reset/line break per record
+            constexpr size_t MAX_PARTS = 48;
+            std::array<std::string_view, MAX_PARTS> out, err;
+            size_t outCount = 0, errCount = 0;
+
+            for (const auto& record : batch.records) {
+                const bool isErr = record.site->level == LogLevel::Error || record.site->level == LogLevel::Fatal;
+                auto& parts = isErr ? err : out;
+                auto& count = isErr ? errCount : outCount;
+
+                if (count + 3 > MAX_PARTS) {
+                    isErr ? OSAL::eprintv({parts.data(), count}) : OSAL::printv({parts.data(), count});
+                    count = 0;
                 }
+                parts[count++] = m_colored ? color(record.site->level) : std::string_view{};
+                parts[count++] = record.line;
+                parts[count++] = m_colored ? RESET_NEWLINE : NEWLINE;
             }
-            return "";
+
+            if (outCount > 0) OSAL::printv({out.data(), outCount});
+            if (errCount > 0) OSAL::eprintv({err.data(), errCount});
         }
 
-        #define METHOD_NAME functionToLocation(std::source_location::current().function_name())
+    private:
+    #if defined(EATK_PLATFORM_ARM)
+        static constexpr std::string_view NEWLINE = "\r\n";
+        static constexpr std::string_view RESET_NEWLINE = "\033[0m\r\n";
     #else
-        #define METHOD_NAME "unknown"
+        static constexpr std::string_view NEWLINE = "\n";
+        static constexpr std::string_view RESET_NEWLINE = "\033[0m\n";
     #endif
-    
+
+        static constexpr std::string_view color(const LogLevel level)
+        {
+            switch (level) {
+                case LogLevel::Info:        return "\033[32m";
+                case LogLevel::Warn:        return "\033[33m";
+                case LogLevel::Error:       return "\033[31m";
+                case LogLevel::Fatal:       return "\033[31m";
+                case LogLevel::Highlight:   return "\033[36m";
+                default:                    return "\033[0m";
+            }
+        }
+
+        bool m_colored;
+    };
+
     class ILogger
     {
     public:
         static void init(int prio);
         static void shutdown();
 
-        enum class LogLevel 
-        {
-            Trace = 0,
-            Info,
-            Warn,
-            Error,
-            Fatal,
-            Highlight,
-            Abort = 99
-        };
+        using LogLevel = ::LogLevel;
 
+        // Fixed-size, trivially copyable log record. The producer only copies the raw
+        // arguments into args, the logging thread formats them through format.
         struct LogData
         {
-            LogLevel level;
+            using FormatFn = void(*)(std::string& out, std::string_view fmt, std::span<const std::byte> args);
+
+            const LogSite* site;
             Timestamp ts;
-            std::string loc;
-            std::string msg;
+            std::string_view fmt;
+            FormatFn format;
+            size_t size;
+            std::array<std::byte, EATK_LOG_ARGS_SIZE> args;
         };
 
+        // arguments that are copied into the record as raw bytes and formatted later,
+        // anything else is formatted on the caller's thread
+        template<typename T>
+        static constexpr bool isDeferrableArg()
+        {
+            using Arg = std::remove_cvref_t<T>;
+            if constexpr (is_deferrable_log_arg_v<Arg>)
+                static_assert(std::is_trivially_copyable_v<Arg>, "deferrable log arguments have to be trivially copyable");
+            return std::is_arithmetic_v<Arg> || std::is_enum_v<Arg> || is_deferrable_log_arg_v<Arg>;
+        }
+
+        template<typename... T>
+        static constexpr bool isDeferrable()
+        {
+            return (isDeferrableArg<T>() && ...) && (sizeof(std::remove_cvref_t<T>) + ... + 0) <= EATK_LOG_ARGS_SIZE;
+        }
+
+        // replaces the end of a message that was cut off at EATK_LOG_ARGS_SIZE
+        static constexpr std::string_view TRUNCATION_MARKER = "...";
+
+        ILogger()
+        {
+            OSAL::createMutex(m_levelMutex);
+            OSAL::createMutex(m_sinkMutex);
+        }
         virtual ~ILogger() = default;
+
+        // ----------------------------------------
+        // --- sinks
+        // ----------------------------------------
+        // sinks are not owned and have to outlive their registration
+        bool addSink(ILogSink& sink);
+        void removeSink(ILogSink& sink);
+
+        // ----------------------------------------
+        // --- runtime levels
+        // ----------------------------------------
+        // A module is a location ("Network") or a location prefix ("Adapter" for "Adapter::send"),
+        // the longest matching module wins, sites without a module use the default level.
+        void setLevel(const LogLevel level);
+        bool setLevel(std::string_view module, const LogLevel level);
+        void resetLevel(std::string_view module);
+        LogLevel level(std::string_view location) const;
+
+        // ----------------------------------------
+        // --- overload handling
+        // ----------------------------------------
+        // param is the timeout in microseconds for Block and N for Sample
+        void setOverflowPolicy(const LogOverflowPolicy policy, const uint32_t param = 0)
+        {
+            m_overflowParam.store(param, std::memory_order_relaxed);
+            m_overflowPolicy.store(policy, std::memory_order_relaxed);
+        }
+
+        LogStats stats() const
+        {
+            return LogStats{
+                .enqueued   = m_enqueued.load(std::memory_order_relaxed),
+                .dropped    = m_dropped.load(std::memory_order_relaxed),
+                .highWater  = m_highWater.load(std::memory_order_relaxed)
+            };
+        }
+
+        bool enabled(const LogSite& site, LogSiteLevel& siteLevel) const
+        {
+            const uint32_t generation = m_levelGeneration.load(std::memory_order_acquire);
+            uint32_t cache = siteLevel.cache.load(std::memory_order_relaxed);
+            if ((cache >> 8) != generation) {
+                cache = (generation << 8) | static_cast<uint32_t>(level(site.location));
+                siteLevel.cache.store(cache, std::memory_order_relaxed);
+            }
+            return static_cast<uint32_t>(site.level) >= (cache & 0xFF);
+        }
  
         template<typename... T>
-        void trace(const bool background, std::string location, std::format_string<T...> fmt, T&&... args)
+        void log(const LogSite& site, const bool background, std::format_string<T...> fmt, T&&... args)
         {
-            background ?
-                addMessage(LogLevel::Trace, OSAL::currentTime(), std::move(location), std::format(fmt, std::forward<T>(args)...)) :
-                printMessage(LogLevel::Trace, OSAL::currentTime(), location, std::format(fmt, std::forward<T>(args)...));
+            if (!background) {
+                StaticString<EATK_LOG_LINE_SIZE> message;
+                formatTo(message, fmt, std::forward<T>(args)...);
+                printMessage(site, OSAL::currentTime(), message);
+                return;
+            }
+
+            LogData data;
+            data.site = &site;
+            data.ts = OSAL::currentTime();
+            data.fmt = fmt.get();
+            if constexpr (isDeferrable<T...>()) {
+                data.format = &formatArgs<std::remove_cvref_t<T>...>;
+                data.size = 0;
+                (storeArg(data, args), ...);
+            }
+            else {
+                const auto result = std::format_to_n(reinterpret_cast<char*>(data.args.data()), data.args.size(), fmt, std::forward<T>(args)...);
+                data.format = &formatText;
+                data.size = std::min(static_cast<size_t>(result.size), data.args.size());
+                if (static_cast<size_t>(result.size) > data.args.size())
+                    std::ranges::copy(TRUNCATION_MARKER, reinterpret_cast<char*>(data.args.data()) + data.args.size() - TRUNCATION_MARKER.size());
+            }
+            addMessage(std::move(data));
         }
 
-        template<typename... T>
-        void info(const bool background, std::string location, std::format_string<T...> fmt, T&&... args)
+        // renders the message of a record, called by the logging thread
+        static void formatMessage(std::string& out, const LogData& data)
         {
-            background ?
-                addMessage(LogLevel::Info, OSAL::currentTime(), std::move(location), std::format(fmt, std::forward<T>(args)...)) :
-                printMessage(LogLevel::Info, OSAL::currentTime(), location, std::format(fmt, std::forward<T>(args)...));
+            data.format(out, data.fmt, std::span<const std::byte>{data.args.data(), data.size});
         }
 
-        template<typename... T>
-        void warn(const bool background, std::string location, std::format_string<T...> fmt, T&&... args)
+    protected:
+        virtual void addMessage(LogData&& data) = 0;
+
+        // renders "[time] <location>: " in front of the message
+        static void formatPrefix(std::string& out, const LogSite& site, const Timestamp& timestamp)
         {
-            background ?
-                addMessage(LogLevel::Warn, OSAL::currentTime(), std::move(location), std::format(fmt, std::forward<T>(args)...)) :
-                printMessage(LogLevel::Warn, OSAL::currentTime(), location, std::format(fmt, std::forward<T>(args)...));
+            std::format_to(std::back_inserter(out), "[{}] <{}>: ", timestamp.timeStr(), site.location);
         }
 
-        template<typename... T>
-        void error(const bool background, std::string location, std::format_string<T...> fmt, T&&... args)
+        template<size_t N>
+        static void formatPrefix(StaticString<N>& out, const LogSite& site, const Timestamp& timestamp)
         {
-            background ?
-                addMessage(LogLevel::Error, OSAL::currentTime(), std::move(location), std::format(fmt, std::forward<T>(args)...)) :
-                printMessage(LogLevel::Error, OSAL::currentTime(), location, std::format(fmt, std::forward<T>(args)...));
+            formatTo(out, "[{}] <{}>: ", timestamp.timeStr(), site.location);
         }
 
-        template<typename... T>
-        void fatal(const bool background, std::string location, std::format_string<T...> fmt, T&&... args)
+        void countEnqueued(const size_t fill)
         {
-            background ?
-                addMessage(LogLevel::Fatal, OSAL::currentTime(), std::move(location), std::format(fmt, std::forward<T>(args)...)) :
-                printMessage(LogLevel::Fatal, OSAL::currentTime(), location, std::format(fmt, std::forward<T>(args)...));
+            m_enqueued.fetch_add(1, std::memory_order_relaxed);
+            size_t highWater = m_highWater.load(std::memory_order_relaxed);
+            while (fill > highWater && !m_highWater.compare_exchange_weak(highWater, fill, std::memory_order_relaxed));
+        }
+
+        void countDropped() { m_dropped.fetch_add(1, std::memory_order_relaxed); }
+
+        std::atomic<LogOverflowPolicy> m_overflowPolicy = LogOverflowPolicy::DropNewest;
+        std::atomic_uint32_t m_overflowParam = 0;
+
+        // synchronous path of the *_NOW macros
+        void printMessage(const LogSite& site, const Timestamp& timestamp, std::string_view message);
+        void writeSinks(const LogBatch& batch);
+
+    private:
+        template<typename T>
+        static void storeArg(LogData& data, const T& arg)
+        {
+            std::memcpy(data.args.data() + data.size, &arg, sizeof(T));
+            data.size += sizeof(T);
+        }
+
+        template<typename T>
+        static T loadArg(const std::byte*& args)
+        {
+            alignas(T) std::array<std::byte, sizeof(T)> storage;
+            std::memcpy(storage.data(), args, sizeof(T));
+            args += sizeof(T);
+            return *std::launder(reinterpret_cast<T*>(storage.data()));
         }
 
         template<typename... T>
-        void highlight(const bool background, std::string location, std::format_string<T...> fmt, T&&... args)
+        static void formatArgs(std::string& out, std::string_view fmt, std::span<const std::byte> args)
         {
-            background ?
-                addMessage(LogLevel::Highlight, OSAL::currentTime(), std::move(location), std::format(fmt, std::forward<T>(args)...)) :
-                printMessage(LogLevel::Highlight, OSAL::currentTime(), location, std::format(fmt, std::forward<T>(args)...));
+            [[maybe_unused]] const std::byte* it = args.data();
+            std::tuple<T...> values{ loadArg<T>(it)... };
+            std::apply([&](auto&... v) { std::vformat_to(std::back_inserter(out), fmt, std::make_format_args(v...)); }, values);
         }
 
-    protected:
-        virtual void addMessage(const LogLevel level, const Timestamp& timestamp, std::string&& location, std::string&& message) = 0;
-        virtual void printMessage(const LogLevel level, const Timestamp& timestamp, const std::string& location, const std::string& message) const = 0;
+        static void formatText(std::string& out, std::string_view, std::span<const std::byte> args)
+        {
+            out.append(reinterpret_cast<const char*>(args.data()), args.size());
+        }
+
+        struct ModuleLevel
+        {
+            std::array<char, EATK_LOG_MODULE_NAME_SIZE> name;
+            size_t length = 0;
+            LogLevel level = LogLevel::Trace;
+        };
+
+        OSAL::StaticImpl::Mutex m_sinkMutex;
+        StaticVector<ILogSink*, EATK_LOG_MAX_SINKS> m_sinks;
+
+        mutable OSAL::StaticImpl::Mutex m_levelMutex;
+        std::array<ModuleLevel, EATK_LOG_MAX_MODULES> m_modules;
+        LogLevel m_defaultLevel = LogLevel::Trace;
+        // starts at 1 so that every site resolves its level once
+        std::atomic_uint32_t m_levelGeneration = 1;
+
+        std::atomic_size_t m_enqueued = 0;
+        std::atomic_size_t m_dropped = 0;
+        std::atomic_size_t m_highWater = 0;
     };
 
     extern ILogger* g_logger;
     extern std::span<std::byte> g_loggerStack;
 
-    template<size_t MsgQueueSize, size_t ThreadStackSize>
+    // BatchSize bounds the number of records rendered and handed to the sinks per batch,
+    // the logging thread keeps draining batches until the queue is empty before it sleeps.
+    template<size_t MsgQueueSize, size_t ThreadStackSize, size_t BatchSize = 32>
     class Logger : public ILogger
     {
+        static_assert(BatchSize > 0, "logger batch size must not be zero");
+
+        static constexpr size_t PRESSURE_LEVEL = MsgQueueSize - MsgQueueSize/4;
+        // poll interval of a producer blocked by LogOverflowPolicy::Block
+        static constexpr uint64_t BLOCK_POLL_US = 100;
+
     public:
         Logger(int prio)
         {
             Utils::setupStaticMessageQueue(m_queue);
             Utils::setupStaticThread(m_thread, false);
             m_thread.thread.get()->setPriority(prio);
+            OSAL::createMutex(m_consumerMutex);
+            addSink(m_console);
         }
 
         ~Logger()
         {
             m_thread.printStackUsage();
             m_running = false;
-            Utils::emplaceStaticMessageQueue<LogData>(m_queue, LogLevel::Abort, Timestamp{}, "", "");
+            static constexpr LogSite abortSite EATK_LOG_SITE(LogLevel::Abort);
+            LogData abort{};
+            abort.site = &abortSite;
+            Utils::pushStaticMessageQueue(m_queue, std::move(abort));
             Utils::shutdownStaticThread(m_thread);
         }
 
@@ -166,58 +520,149 @@
             m_thread.thread.get()->start();
         }
 
+        ConsoleLogSink& console() { return m_console; }
+
     private:
-        void addMessage(const LogLevel level, const Timestamp& timestamp, std::string&& location, std::string&& message) override
+        void addMessage(LogData&& data) override
+        {
+            bool queued = false;
+            switch (m_overflowPolicy.load(std::memory_order_relaxed)) {
+                case LogOverflowPolicy::DropNewest:
+                    queued = push(data);
+                    break;
+
+                case LogOverflowPolicy::DropOldest:
+                    queued = push(data);
+                    if (!queued) {
+                        // The consumer side of the ring is single threaded, evicting shares it with the logging thread.
+                        // A producer never waits for the logging thread to finish a batch, it drops its own message instead.
+                        std::unique_lock lock(*m_consumerMutex.get(), std::try_to_lock);
+                        for (size_t i = 0; i < MsgQueueSize && !queued && lock.owns_lock(); ++i) {
+                            if (m_queue.queue.pop()) countDropped();
+                            queued = push(data);
+                        }
+                    }
+                    break;
+
+                case LogOverflowPolicy::Block: {
+                    queued = push(data);
+                    if (queued)
+                        break;
+
+                    const uint64_t deadline = OSAL::monotonicTime() + m_overflowParam.load(std::memory_order_relaxed);
+                    while (!queued && OSAL::monotonicTime() < deadline) {
+                        OSAL::sleep(BLOCK_POLL_US);
+                        queued = push(data);
+                    }
+                    break;
+                }
+
+                case LogOverflowPolicy::Sample: {
+                    const uint32_t n = std::max<uint32_t>(m_overflowParam.load(std::memory_order_relaxed), 1);
+                    if (m_queue.queue.size() < PRESSURE_LEVEL || m_sample.fetch_add(1, std::memory_order_relaxed) % n == 0)
+                        queued = push(data);
+                    break;
+                }
+            }
+
+            if (!queued)
+                countDropped();
+        }
+
+        bool push(const LogData& data)
         {
-            Utils::emplaceStaticMessageQueue<LogData>(m_queue, level, timestamp, std::move(location), std::move(message));
+            if (!Utils::pushStaticMessageQueue(m_queue, data))
+                return false;
+            countEnqueued(m_queue.queue.size());
+            return true;
         }
 
-        void printMessage(const LogLevel level, const Timestamp& timestamp, const std::string& location, const std::string& message) const override
+        // renders up to BatchSize records straight out of the ring, false if it was empty
+        bool renderBatch(std::string& text, StaticVector<LogRecord, BatchSize + 1>& records, std::array<std::pair<size_t, size_t>, BatchSize + 1>& offsets)
         {
-            auto consoleColor = ConsoleColor::Standard;
-            bool err = false;
-            switch (level) {
-                case LogLevel::Trace:       consoleColor = ConsoleColor::Standard;  err = false;    break;
-                case LogLevel::Info:        consoleColor = ConsoleColor::Green;     err = false;    break;
-                case LogLevel::Warn:        consoleColor = ConsoleColor::Yellow;    err = false;    break;
-                case LogLevel::Error:       consoleColor = ConsoleColor::Red;       err = true;     break;
-                case LogLevel::Fatal:       consoleColor = ConsoleColor::Red;       err = true;     break;
-                case LogLevel::Highlight:   consoleColor = ConsoleColor::Cyan;      err = false;    break;
-                case LogLevel::Abort:       return;
-            }
+            std::lock_guard lock(*m_consumerMutex.get());
+            const auto view = m_queue.queue.drain(BatchSize);
+            if (view.empty())
+                return false;
+
+            for (const LogData& data : view) {
+                if (data.site->level == LogLevel::Abort) {
+                    m_running = false;
+                    continue;
+                }
 
-            const auto msg = std::format("[{}] <{}>: {}", timestamp.timeStr(), location, message);
+                const size_t begin = text.size();
+                formatPrefix(text, *data.site, data.ts);
+                const size_t message = text.size();
+                formatMessage(text, data);
+                offsets[records.size()] = {begin, message};
+                records.push_back(LogRecord{ data.site, data.ts, {}, {} });
+                text.push_back('\n');
+            }
+            return true;
+        }
 
-            OSAL::setConsoleColor(consoleColor);
-            if (err) OSAL::eprintln(msg.c_str());
-            else OSAL::println(msg.c_str());
-            OSAL::setConsoleColor(ConsoleColor::Standard);
+        // renders a "N messages dropped" record once the queue ran empty after an overload
+        void reportDropped(std::string& text, StaticVector<LogRecord, BatchSize + 1>& records, std::array<std::pair<size_t, size_t>, BatchSize + 1>& offsets)
+        {
+            static constexpr LogSite droppedSite EATK_LOG_SITE_LOC(LogLevel::Warn, "Logger");
+
+            const size_t dropped = stats().dropped;
+            if (dropped == m_reportedDropped || !m_queue.queue.empty())
+                return;
+
+            const Timestamp ts = OSAL::currentTime();
+            const size_t begin = text.size();
+            formatPrefix(text, droppedSite, ts);
+            const size_t message = text.size();
+            std::format_to(std::back_inserter(text), "{} messages dropped", dropped - m_reportedDropped);
+            offsets[records.size()] = {begin, message};
+            records.push_back(LogRecord{ &droppedSite, ts, {}, {} });
+            text.push_back('\n');
+            m_reportedDropped = dropped;
         }
 
         void loggingTask()
         {
-            StaticQueue<LogData, 8> localQueue;
+            StaticVector<LogRecord, BatchSize + 1> records;
+            std::array<std::pair<size_t, size_t>, BatchSize + 1> offsets;
+            std::string text;
 
             m_running = true;
-            while (m_running || !m_queue.queue.get()->empty()) {
-                if (!Utils::popAvailStaticMessageQueue(m_queue, localQueue))
+            while (m_running || !m_queue.queue.empty()) {
+                // the records are rendered into one buffer first, views are taken afterwards
+                // since the buffer may grow while rendering
+                text.clear();
+                records.clear();
+                if (!renderBatch(text, records, offsets)) {
+                    if (m_running)
+                        m_queue.waiter.wait([this]() { return m_queue.queue.empty(); });
+                    continue;
+                }
+                reportDropped(text, records, offsets);
+
+                if (records.empty())
                     continue;
 
-                for (const auto& [level, timestamp, location, message] : localQueue) {
-                    if (level == LogLevel::Abort)
-                        m_running = false;
-                    else
-                        printMessage(level, timestamp, location, message);
+                for (size_t i = 0; i < records.size(); ++i) {
+                    const auto [begin, message] = offsets[i];
+                    const size_t end = (i + 1 < records.size() ? offsets[i + 1].first : text.size()) - 1;
+                    records[i].line = std::string_view{text}.substr(begin, end - begin);
+                    records[i].message = std::string_view{text}.substr(message, end - message);
                 }
-                localQueue.clear();
+                writeSinks(LogBatch{ text, {records.data(), records.size()} });
             }
         }
 
+        ConsoleLogSink m_console;
+        OSAL::StaticImpl::Mutex m_consumerMutex;
+        std::atomic_uint32_t m_sample = 0;
+        size_t m_reportedDropped = 0;
         std::atomic_bool m_running;
         Utils::StaticThread<OSAL::StaticImpl::Thread, "Loggin Thread", ThreadStackSize, 10, []() -> void {
-            static_cast<Logger<MsgQueueSize, ThreadStackSize>*>(g_logger)->loggingTask(); 
+            static_cast<Logger<MsgQueueSize, ThreadStackSize, BatchSize>*>(g_logger)->loggingTask(); 
         }> m_thread;
-        Utils::StaticMessageQueue<OSAL::StaticImpl::MessageQueue, LogData, MsgQueueSize> m_queue;
+        Utils::StaticTypedMessageQueue<LogData, MsgQueueSize> m_queue;
     };
 
 #else
@@ -7,6 +7,7 @@
 #include "Core/Bits.h"
 #include "Core/Concepts.h"
 #include "Core/Logger.h"
+#include "Core/LogSink.h"
 
 #include "Memory/Memory.h"
 #include "Memory/Buffer.h"
@@ -17,10 +18,18 @@
 
 #include "Container/Container.h"
 #include "Container/Vector.h"
+#include "Container/String.h"
 #include "Container/Queue.h"
+#include "Container/LockFreeQueue.h"
 #include "Container/Map.h"
+#include "Container/ConstexprMap.h"
+#include "Container/SoAVector.h"
+#include "Container/Intrusive.h"
+#include "Container/WorkStealingDeque.h"
 
 #include "OSAL/OSAL.h"
+#include "OSAL/ConsumerWaiter.h"
+#include "OSAL/CycleStatistic.h"
 
 #include "Network/NetworkAdapter.h"
 
@@ -30,5 +39,8 @@
 #include "StateMachine/SubstateGroup.h"
 
 #include "Utils/Thread.h"
+#include "Utils/CyclicExecutor.h"
+#include "Utils/ThreadPool.h"
+#include "Utils/TimerWheel.h"
 #include "Utils/Timestamp.h"
 #include "Utils/MessageQueue.h"
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "Buffer.h"
 
+#include "EmbedATK/Core/Core.h"
+
 //------------------------------------------------------
 //                    Pools
 //------------------------------------------------------
@@ -14,7 +16,25 @@ public:
     virtual const void* data() const = 0;
 };
 
-template<size_t N, AllocData Block>
+// What happens to the memory of a block when it is returned to a pool.
+// Poison fills freed blocks with POOL_POISON_VALUE and checks on allocation that the 
+// pattern is still intact, so writes through dangling pointers are detected.
+enum class ClearPolicy
+{
+    None,
+    Zero,
+    Poison
+};
+
+inline constexpr std::byte POOL_POISON_VALUE{0xDD};
+
+#if defined(NDEBUG)
+inline constexpr ClearPolicy DEFAULT_POOL_CLEAR_POLICY = ClearPolicy::None;
+#else
+inline constexpr ClearPolicy DEFAULT_POOL_CLEAR_POLICY = ClearPolicy::Poison;
+#endif
+
+template<size_t N, AllocData Block, ClearPolicy Policy = DEFAULT_POOL_CLEAR_POLICY>
 class StaticBlockPool : public IPool
 {
     struct FreeBlock {
@@ -28,6 +48,10 @@ public:
     StaticBlockPool() 
         : m_buff{}, m_freeBlocks{nullptr}
     {
+        if constexpr (Policy == ClearPolicy::Poison) {
+            m_buff.fillBlock(0, N, POOL_POISON_VALUE);
+        }
+
         for (size_t i = N; i > 0; --i) {
             auto* freeBlock = reinterpret_cast<FreeBlock*>(&m_buff.atBlock(i-1));
             freeBlock->next = m_freeBlocks;
@@ -72,6 +96,17 @@ private:
         }
 
         FreeBlock* allocatedBlock = m_freeBlocks;
+
+        if constexpr (Policy == ClearPolicy::Poison) {
+            // everything behind the free list link has to be untouched since the block was freed
+            const auto* poisoned = reinterpret_cast<const std::byte*>(allocatedBlock) + sizeof(FreeBlock);
+            const bool intact = std::all_of(poisoned, poisoned + (Block.size - sizeof(FreeBlock)), 
+                [](std::byte b) { return b == POOL_POISON_VALUE; });
+            if (!intact) [[unlikely]] {
+                throw std::logic_error("pool block was written after it had been freed");
+            }
+        }
+
         m_freeBlocks = allocatedBlock->next;
 
         return allocatedBlock;
@@ -88,7 +123,12 @@ private:
         }
 
         const size_t index = addrToFree - startAddr;
-        m_buff.clear(index, Block.size);
+        if constexpr (Policy == ClearPolicy::Zero) {
+            m_buff.clear(index, Block.size);
+        }
+        else if constexpr (Policy == ClearPolicy::Poison) {
+            m_buff.fill(index, Block.size, POOL_POISON_VALUE);
+        }
 
         auto* freedBlock = static_cast<FreeBlock*>(p);
         freedBlock->next = m_freeBlocks;
@@ -104,6 +144,307 @@ private:
     FreeBlock* m_freeBlocks;
 };
 
+// Block pool which can be shared between threads without a lock. 
+// The free list head packs a block index and a modification tag into one atomic word,
+// every successful exchange increments the tag so a stale head can never be swapped in (ABA).
+// Threads with a high allocation rate can put a Magazine in front of the pool, which caches 
+// blocks locally and exchanges them with the shared free list in batches.
+template<size_t N, AllocData Block, ClearPolicy Policy = DEFAULT_POOL_CLEAR_POLICY>
+class ConcurrentBlockPool : public IPool
+{
+    // half of the head word holds the index, word size is chosen to stay lock-free on 32-bit targets
+    using HeadType  = std::conditional_t<(sizeof(void*) >= 8), uint64_t, uint32_t>;
+    using IndexType = std::conditional_t<(sizeof(void*) >= 8), uint32_t, uint16_t>;
+
+    static constexpr size_t IndexBits = 8*sizeof(IndexType);
+    static constexpr IndexType NoBlock = std::numeric_limits<IndexType>::max();
+
+    struct FreeBlock {
+        std::atomic<IndexType> next = NoBlock;
+    };
+
+    static_assert(N < NoBlock, "too many blocks for the free list index");
+    static_assert(Block.size >= sizeof(FreeBlock),
+	  "invalid block size, size needs to be at least the size of an index");
+    static_assert(std::atomic<HeadType>::is_always_lock_free);
+
+public:
+    template<size_t M>
+    class Magazine;
+
+    ConcurrentBlockPool() 
+        : m_buff{}
+    {
+        if constexpr (Policy == ClearPolicy::Poison) {
+            m_buff.fillBlock(0, N, POOL_POISON_VALUE);
+        }
+
+        for (size_t i = 0; i < N; ++i) {
+            std::construct_at(block(i), static_cast<IndexType>(i+1 < N ? i+1 : NoBlock));
+        }
+        m_head.store(pack(N > 0 ? 0 : NoBlock, 0), std::memory_order_release);
+    }
+
+    ConcurrentBlockPool(const ConcurrentBlockPool&) = delete;
+    ConcurrentBlockPool& operator=(const ConcurrentBlockPool&) = delete;
+    ConcurrentBlockPool(ConcurrentBlockPool&&) = delete;
+    ConcurrentBlockPool& operator=(ConcurrentBlockPool&&) = delete;
+
+    ~ConcurrentBlockPool() = default;
+
+    void* data() override { return m_buff.data(); }
+    const void* data() const override{ return m_buff.data(); }
+
+    template<typename T, typename ...Args>
+    T* construct(Args&&... args) 
+    {
+        static_assert(allocData<T>() == Block);
+        auto* ptr = static_cast<T*>(std::pmr::memory_resource::allocate(Block.size, Block.align));
+        std::construct_at<T>(ptr, std::forward<Args>(args)...);
+        return ptr;
+    }
+
+    // like construct(), but returns nullptr instead of throwing when the pool ran empty;
+    // checking hasSpace() first is no guarantee while other threads allocate
+    template<typename T, typename ...Args>
+    T* tryConstruct(Args&&... args)
+    {
+        static_assert(allocData<T>() == Block);
+        void* p = nullptr;
+        if (popMany(std::span<void*>{&p, 1}) == 0) 
+            return nullptr;
+
+        verify(p);
+        return std::construct_at<T>(static_cast<T*>(p), std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void destroy(T* ptr)
+    {
+        static_assert(allocData<T>() == Block);
+        std::destroy_at(ptr);
+        std::pmr::memory_resource::deallocate(ptr, Block.size, Block.align);
+    }
+    
+    // only a snapshot while other threads are allocating
+    bool hasSpace() const { return index(m_head.load(std::memory_order_relaxed)) != NoBlock; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override 
+    {
+        if (bytes > Block.size || alignment > Block.align) [[unlikely]] {
+            throw std::bad_alloc{};
+        }
+
+        void* p = nullptr;
+        if (popMany(std::span<void*>{&p, 1}) == 0) [[unlikely]] {
+            throw std::bad_alloc{};
+        }
+
+        verify(p);
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t) override 
+    {
+        release(p, bytes);
+        pushMany(std::span<void* const>{&p, 1});
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override 
+    {
+        return this == &other;
+    }
+
+    // ----------------------------------------
+    // --- free list
+    // ----------------------------------------
+    static constexpr HeadType pack(size_t idx, HeadType tag) { return (tag << IndexBits) | static_cast<HeadType>(idx); }
+    static constexpr IndexType index(HeadType head) { return static_cast<IndexType>(head); }
+    static constexpr HeadType tag(HeadType head) { return head >> IndexBits; }
+
+    FreeBlock* block(size_t idx) { return reinterpret_cast<FreeBlock*>(m_buff.data() + idx*Block.size); }
+    size_t indexOf(const void* p) const 
+    { 
+        return (reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(m_buff.data())) / Block.size; 
+    }
+
+    // detaches up to blocks.size() blocks from the free list with a single exchange
+    size_t popMany(std::span<void*> blocks)
+    {
+        if (blocks.empty()) return 0;
+
+        HeadType head = m_head.load(std::memory_order_acquire);
+        while (true) {
+            size_t count = 0;
+            IndexType idx = index(head);
+            while (idx != NoBlock && idx < N && count < blocks.size()) {
+                blocks[count++] = block(idx);
+                idx = block(idx)->next.load(std::memory_order_relaxed);
+            }
+            if (count == 0) return 0;
+
+            // a block of the chain was handed out meanwhile and its link overwritten
+            if (idx != NoBlock && idx >= N) {
+                head = m_head.load(std::memory_order_acquire);
+                continue;
+            }
+
+            // a changed tag means the chain may have been modified while walking it
+            if (m_head.compare_exchange_weak(head, pack(idx, tag(head) + 1), std::memory_order_acquire, std::memory_order_acquire))
+                return count;
+        }
+    }
+
+    // links the blocks into a chain and attaches it to the free list with a single exchange
+    void pushMany(std::span<void* const> blocks)
+    {
+        if (blocks.empty()) return;
+
+        for (size_t i = 0; i + 1 < blocks.size(); ++i) {
+            static_cast<FreeBlock*>(blocks[i])->next.store(static_cast<IndexType>(indexOf(blocks[i+1])), std::memory_order_relaxed);
+        }
+
+        auto* last = static_cast<FreeBlock*>(blocks.back());
+        const auto first = indexOf(blocks.front());
+        HeadType head = m_head.load(std::memory_order_relaxed);
+        do {
+            last->next.store(index(head), std::memory_order_relaxed);
+        } while (!m_head.compare_exchange_weak(head, pack(first, tag(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // ----------------------------------------
+    // --- clear policy
+    // ----------------------------------------
+    void release(void* p, size_t bytes)
+    {
+        const auto addrToFree = reinterpret_cast<uintptr_t>(p);
+        const auto startAddr = reinterpret_cast<uintptr_t>(m_buff.data());
+        const auto endAddr = startAddr + (N*Block.size);
+
+        if (p == nullptr || addrToFree < startAddr || (addrToFree+bytes) > endAddr) [[unlikely]] {
+            throw std::invalid_argument("Deallocation error");
+        }
+
+        const size_t index = addrToFree - startAddr;
+        if constexpr (Policy == ClearPolicy::Zero) {
+            m_buff.clear(index, Block.size);
+        }
+        else if constexpr (Policy == ClearPolicy::Poison) {
+            m_buff.fill(index, Block.size, POOL_POISON_VALUE);
+        }
+    }
+
+    void verify(const void* p) const
+    {
+        if constexpr (Policy == ClearPolicy::Poison) {
+            const auto* poisoned = static_cast<const std::byte*>(p) + sizeof(FreeBlock);
+            const bool intact = std::all_of(poisoned, poisoned + (Block.size - sizeof(FreeBlock)), 
+                [](std::byte b) { return b == POOL_POISON_VALUE; });
+            if (!intact) [[unlikely]] {
+                throw std::logic_error("pool block was written after it had been freed");
+            }
+        }
+        else {
+            EATK_UNUSED(p);
+        }
+    }
+
+    StaticBlockBuffer<N, Block> m_buff;
+    alignas(EATK_CACHE_LINE_SIZE) std::atomic<HeadType> m_head;
+};
+
+// Thread local cache in front of a ConcurrentBlockPool, must only be used by the owning thread.
+// Refills take half of the capacity from the pool at once, a full magazine hands half 
+// of its blocks back at once. The remaining blocks are returned on destruction.
+template<size_t N, AllocData Block, ClearPolicy Policy>
+template<size_t M>
+class ConcurrentBlockPool<N, Block, Policy>::Magazine : public IPool
+{
+    static_assert(M > 0, "magazine needs to hold at least one block");
+    static constexpr size_t Batch = std::max<size_t>(M / 2, 1);
+
+public:
+    explicit Magazine(ConcurrentBlockPool& pool) 
+        : m_pool(pool) 
+    {}
+
+    Magazine(const Magazine&) = delete;
+    Magazine& operator=(const Magazine&) = delete;
+    Magazine(Magazine&&) = delete;
+    Magazine& operator=(Magazine&&) = delete;
+
+    ~Magazine() { flush(); }
+
+    void* data() override { return m_pool.data(); }
+    const void* data() const override{ return m_pool.data(); }
+
+    template<typename T, typename ...Args>
+    T* construct(Args&&... args) 
+    {
+        static_assert(allocData<T>() == Block);
+        auto* ptr = static_cast<T*>(std::pmr::memory_resource::allocate(Block.size, Block.align));
+        std::construct_at<T>(ptr, std::forward<Args>(args)...);
+        return ptr;
+    }
+
+    template<typename T>
+    void destroy(T* ptr)
+    {
+        static_assert(allocData<T>() == Block);
+        std::destroy_at(ptr);
+        std::pmr::memory_resource::deallocate(ptr, Block.size, Block.align);
+    }
+
+    bool hasSpace() const { return m_count > 0 || m_pool.hasSpace(); }
+    size_t cached() const { return m_count; }
+
+    void flush()
+    {
+        m_pool.pushMany(std::span<void* const>{m_blocks.data(), m_count});
+        m_count = 0;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override 
+    {
+        if (bytes > Block.size || alignment > Block.align) [[unlikely]] {
+            throw std::bad_alloc{};
+        }
+
+        if (m_count == 0) {
+            m_count = m_pool.popMany(std::span<void*>{m_blocks.data(), Batch});
+            if (m_count == 0) [[unlikely]] {
+                throw std::bad_alloc{};
+            }
+        }
+
+        void* p = m_blocks[--m_count];
+        m_pool.verify(p);
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t) override 
+    {
+        m_pool.release(p, bytes);
+
+        if (m_count == M) {
+            m_count -= Batch;
+            m_pool.pushMany(std::span<void* const>{m_blocks.data() + m_count, Batch});
+        }
+        m_blocks[m_count++] = p;
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override 
+    {
+        return this == &other;
+    }
+
+    ConcurrentBlockPool& m_pool;
+    std::array<void*, M> m_blocks;
+    size_t m_count = 0;
+};
+
 template<typename T, size_t N>
 class StaticEntiredPool : public IPool
 {
@@ -221,131 +562,4 @@ private:
 
     static constexpr AllocData Alloc = allocData<T>();
     StaticBuffer<N*Alloc.size, Alloc.align> m_buff = {};
-};
-
-template<typename T, size_t N>
-class StaticDequePool : public IPool
-{
-    struct FreeBlock {
-        FreeBlock* next = nullptr;
-    };
-
-#if defined(__GLIBCXX__)
-    struct DequeData : public std::pmr::deque<T>
-    {
-        inline static constexpr size_t NumElementsInBlock = std::__deque_buf_size(sizeof(T));
-        inline static constexpr size_t NumNodes = (N == 0) ? 0 : ((N - 1) / NumElementsInBlock + 1);
-        inline static constexpr size_t InitialMapSize = static_cast<size_t>(std::pmr::deque<T>::_Deque_base::_S_initial_map_size);
-        inline static constexpr size_t MapSize = std::max(InitialMapSize, NumNodes + 2) * sizeof(void*);
-        inline static constexpr size_t DataSize = NumNodes*sizeof(T)*std::__deque_buf_size(sizeof(T));
-        inline static constexpr size_t AllocSize = MapSize + DataSize;
-    };
-#elif defined(_LIBCPP_VERSION)
-    namespace detail
-    {
-        inline constexpr size_t __libcxx_deque_buf_size(size_t s)
-        {
-            if (s == 0) return 16;
-            return std::max(static_cast<size_t>(16), 4096 / s);
-        }
-        inline constexpr size_t __libcxx_initial_map_size = 2;
-    }
-
-    struct DequeData : public std::pmr::deque<T>
-    {
-        inline static constexpr size_t NumElementsInBlock = detail::__libcxx_deque_buf_size(sizeof(T));
-        inline static constexpr size_t NumNodes = (N == 0) ? 0 : ((N - 1) / BlockSizeInElements + 1);
-        inline static constexpr size_t InitialMapSize = detail::__libcxx_initial_map_size;
-        inline static constexpr size_t MapSize = std::max(InitialMapSize, NumNodes + 2) * sizeof(void*);
-        inline static constexpr size_t DataSize = NumNodes * BlockSizeInElements * sizeof(T);
-        inline static constexpr size_t AllocSize = MapSize + DataSize;
-    };
-#endif
-
-    static constexpr size_t NumBlocks       = DequeData::NumNodes;
-    static constexpr size_t BlockSize       = DequeData::NumElementsInBlock * sizeof(T);
-    static constexpr size_t InitialMapSize  = DequeData::InitialMapSize;
-    static constexpr size_t MapSize         = DequeData::MapSize;
-    static constexpr size_t DataSize        = DequeData::DataSize;
-
-    static_assert(BlockSize >= sizeof(FreeBlock),
-	  "invalid block size, size needs to be at least the size of a pointer");
-
-public:
-    StaticDequePool() 
-        : m_mapBuff{}, m_blockBuff{}, m_freeBlocks{nullptr}
-    {
-        if constexpr (NumBlocks > 0) {
-            void* blockStart = m_blockBuff.data();
-            
-            for (size_t i = NumBlocks; i > 0; --i) {
-                void* blockAddr = static_cast<std::byte*>(blockStart) + ((i - 1) * BlockSize);
-                auto* freeBlock = static_cast<FreeBlock*>(blockAddr);
-                freeBlock->next = m_freeBlocks;
-                m_freeBlocks = freeBlock;
-            }
-        }
-    }
-
-    StaticDequePool(const StaticDequePool&) = delete;
-    StaticDequePool& operator=(const StaticDequePool&) = delete;
-    StaticDequePool(StaticDequePool&&) = default;
-    StaticDequePool& operator=(StaticDequePool&&) = default;
-
-    ~StaticDequePool() = default;
-
-    void* data() override { return &m_mapBuff[0]; }
-    const void* data() const override { return &m_mapBuff[0]; }
-
-private:
-    void* do_allocate(size_t bytes, size_t alignment) override 
-    {
-        if (bytes == BlockSize && alignment <= alignof(T) && m_freeBlocks != nullptr) {
-            FreeBlock* allocatedBlock = m_freeBlocks;
-            m_freeBlocks = allocatedBlock->next;
-            return allocatedBlock;
-        }
-
-        if (bytes != BlockSize && bytes <= m_mapBuff.size() && alignment <= alignof(uintptr_t)) {
-            return &m_mapBuff[0];
-        }
-
-        [[unlikely]] throw std::bad_alloc{};
-    }
-
-    void do_deallocate(void* p, size_t bytes, size_t alignment) override 
-    {
-        if (p == nullptr) {
-            return;
-        }
-
-        const auto addrToFree = reinterpret_cast<uintptr_t>(p);
-        const auto mapStartAddr = reinterpret_cast<uintptr_t>(&m_mapBuff[0]);
-        if (addrToFree == mapStartAddr) {
-            return;
-        }
-
-        if constexpr (NumBlocks > 0) {
-            const auto blockStartAddr = reinterpret_cast<uintptr_t>(&m_blockBuff[0]);
-            const auto blockEndAddr = blockStartAddr + DataSize;
-
-            if (addrToFree >= blockStartAddr && addrToFree < blockEndAddr) {
-                auto* freedBlock = static_cast<FreeBlock*>(p);
-                freedBlock->next = m_freeBlocks;
-                m_freeBlocks = freedBlock;
-                return;
-            }
-        }
-
-        [[unlikely]] throw std::invalid_argument("Deallocation error");
-    }
-
-    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override 
-    {
-        return this == &other;
-    }
-
-    StaticBuffer<MapSize == (InitialMapSize*sizeof(uintptr_t)) ? MapSize : 2*MapSize, alignof(uintptr_t)> m_mapBuff;
-    StaticBuffer<DataSize, alignof(T)> m_blockBuff;
-    FreeBlock* m_freeBlocks;
 };
\ No newline at end of file
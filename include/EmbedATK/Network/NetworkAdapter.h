@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EmbedATK/Container/Vector.h"
+#include "EmbedATK/Container/String.h"
 
 enum class EthType : uint16_t
 {
@@ -13,8 +14,11 @@ using MAC = std::array<uint8_t, 6>;
 
 struct NetworkAdapterInfo
 {
-	std::string name;
-	std::string desc;
+	static constexpr size_t NAME_SIZE = 32;
+	static constexpr size_t DESC_SIZE = 64;
+
+	StaticString<NAME_SIZE> name;
+	StaticString<DESC_SIZE> desc;
 	MAC mac;
 };
 
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "OSAL.h"
+
+// Parks the single consumer of a lock-free queue on an OSAL semaphore while the queue is empty.
+// Producers only pay for a fence and a relaxed load unless the consumer is actually sleeping.
+// Semaphore is either a concrete OSAL::Semaphore or a polymorphic holder of one.
+template<typename Semaphore>
+requires std::is_convertible_v<Semaphore&, OSAL::Semaphore&>
+class ConsumerWaiter
+{
+public:
+    Semaphore& semaphore() noexcept { return m_semaphore; }
+
+    // producer side, call after publishing an element
+    void notify()
+    {
+        // pairs with the fence in wait(): either the producer sees the waiting flag
+        // or the consumer sees the new element before going to sleep
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiting.load(std::memory_order_relaxed) && m_waiting.exchange(false, std::memory_order_acq_rel)) {
+            static_cast<OSAL::Semaphore&>(m_semaphore).release();
+        }
+    }
+
+    // consumer side, may return spuriously so callers have to re-check the queue
+    template<typename Predicate>
+    requires std::predicate<Predicate>
+    void wait(Predicate&& empty)
+    {
+        m_waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!std::invoke(empty)) {
+            m_waiting.store(false, std::memory_order_relaxed);
+            return;
+        }
+        static_cast<OSAL::Semaphore&>(m_semaphore).acquire();
+    }
+
+private:
+    alignas(EATK_CACHE_LINE_SIZE) std::atomic_bool m_waiting = false;
+    Semaphore m_semaphore;
+};
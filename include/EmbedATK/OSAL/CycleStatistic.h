@@ -0,0 +1,180 @@
+#pragma once
+
+#include "EmbedATK/Core/Core.h"
+
+// What a cyclic thread does when a cycle ends after the next one should have started.
+//   CatchUp: the missed cycles run back to back until the schedule is met again
+//   Skip:    the missed cycles are dropped, the next one starts on the original grid
+//   Rephase: the next cycle starts right away and the grid is shifted to it
+enum class OverrunPolicy
+{
+    CatchUp,
+    Skip,
+    Rephase
+};
+
+// Sequence counter for one writer and any number of readers, the writer never waits.
+// A reader retries until it read without a write in between. A reader that preempted the writer
+// in the middle of a write would spin forever on a single core, so after READ_RETRIES attempts
+// it keeps the last, possibly mixed read.
+class SequenceLock
+{
+public:
+    static constexpr size_t READ_RETRIES = 64;
+
+    // writer side
+    void beginWrite() noexcept
+    {
+        m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void endWrite() noexcept
+    {
+        m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // reader side, read loads the protected fields with relaxed order
+    template<typename Read>
+    void read(Read&& read) const noexcept
+    {
+        for (size_t attempt = 0; ; ++attempt) {
+            const uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) && attempt < READ_RETRIES)
+                continue;
+
+            read();
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == sequence || attempt >= READ_RETRIES)
+                return;
+        }
+    }
+
+private:
+    std::atomic_uint32_t m_sequence = 0;
+};
+
+// 64 bit counter in two 32 bit atomics, 64 bit ones are not lock-free on Cortex-M.
+// Written by a single thread between SequenceLock::beginWrite() and endWrite(),
+// a reader only gets a consistent value through SequenceLock::read().
+class SplitCounter
+{
+public:
+    uint64_t load() const noexcept
+    {
+        return (static_cast<uint64_t>(m_high.load(std::memory_order_relaxed)) << 32) | m_low.load(std::memory_order_relaxed);
+    }
+
+    void store(const uint64_t value) noexcept
+    {
+        m_low.store(static_cast<uint32_t>(value), std::memory_order_relaxed);
+        m_high.store(static_cast<uint32_t>(value >> 32), std::memory_order_relaxed);
+    }
+
+    void add(const uint64_t value) noexcept { store(load() + value); }
+
+private:
+    std::atomic_uint32_t m_low = 0;
+    std::atomic_uint32_t m_high = 0;
+};
+
+// Min/max/mean and a log2 histogram of one quantity in nanoseconds, cyclictest style.
+// Written by a single thread and readable from any other while the writer keeps running,
+// the fields are 32 bit atomics behind a SequenceLock. Values saturate at about 4.3 s,
+// the count, the sum and the histogram are 64 bit.
+class CycleStatistic
+{
+public:
+    // bucket 0 counts zeros, bucket i counts values in [2^(i-1), 2^i) ns, the last one everything above
+    static constexpr size_t BUCKETS = 32;
+    static constexpr size_t READ_RETRIES = SequenceLock::READ_RETRIES;
+
+    struct Snapshot
+    {
+        uint64_t count = 0;
+        uint64_t min = 0;
+        uint64_t max = 0;
+        uint64_t sum = 0;
+        std::array<uint64_t, BUCKETS> histogram{};
+
+        double mean() const noexcept { return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+
+        // upper bound of the bucket the given fraction (0..1) of all values falls into
+        uint64_t percentile(const double fraction) const noexcept
+        {
+            const auto target = static_cast<uint64_t>(fraction * static_cast<double>(count));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                seen += histogram[i];
+                if (seen > target || (seen == count && seen > 0))
+                    return std::min(upperBound(i), max);
+            }
+            return max;
+        }
+    };
+
+    static constexpr size_t bucket(const uint64_t value) noexcept
+    {
+        return std::min(static_cast<size_t>(std::bit_width(value)), BUCKETS - 1);
+    }
+
+    static constexpr uint64_t upperBound(const size_t bucket) noexcept
+    {
+        return bucket == BUCKETS - 1 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << bucket) - 1;
+    }
+
+    // writer side
+    void record(const uint64_t value) noexcept
+    {
+        const auto clamped = static_cast<uint32_t>(std::min<uint64_t>(value, std::numeric_limits<uint32_t>::max()));
+        const uint64_t count = m_count.load();
+
+        m_lock.beginWrite();
+        if (count == 0 || clamped < m_min.load(std::memory_order_relaxed))
+            m_min.store(clamped, std::memory_order_relaxed);
+        if (clamped > m_max.load(std::memory_order_relaxed))
+            m_max.store(clamped, std::memory_order_relaxed);
+        m_sum.add(clamped);
+        m_histogram[bucket(clamped)].add(1);
+        m_count.store(count + 1);
+        m_lock.endWrite();
+    }
+
+    // writer side, readers have to ask the writer to reset instead of calling it directly
+    void reset() noexcept
+    {
+        m_lock.beginWrite();
+        m_count.store(0);
+        m_min.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+        m_sum.store(0);
+        for (auto& slot : m_histogram) {
+            slot.store(0);
+        }
+        m_lock.endWrite();
+    }
+
+    Snapshot snapshot() const noexcept
+    {
+        Snapshot snapshot;
+        m_lock.read([&]() {
+            snapshot.count = m_count.load();
+            snapshot.min = m_min.load(std::memory_order_relaxed);
+            snapshot.max = m_max.load(std::memory_order_relaxed);
+            snapshot.sum = m_sum.load();
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                snapshot.histogram[i] = m_histogram[i].load();
+            }
+        });
+        return snapshot;
+    }
+
+private:
+    SequenceLock m_lock;
+    SplitCounter m_count;
+    std::atomic_uint32_t m_min = 0;
+    std::atomic_uint32_t m_max = 0;
+    SplitCounter m_sum;
+    std::array<SplitCounter, BUCKETS> m_histogram;
+};
@@ -5,9 +5,12 @@
 #include "EmbedATK/Memory/Polymorphic.h"
 #include "EmbedATK/Memory/Any.h"
 #include "EmbedATK/Container/Queue.h"
+#include "EmbedATK/Container/LockFreeQueue.h"
 
 #include "EmbedATK/Utils/Timestamp.h"
 
+#include "CycleStatistic.h"
+
 enum class ConsoleColor
 {
     Standard,
@@ -17,6 +20,25 @@ enum class ConsoleColor
     Cyan,
 };
 
+enum class SchedPolicy
+{
+    Default,    // platform default, e.g. SCHED_OTHER
+    Fifo,
+    RoundRobin
+};
+
+// Real-time setup applied when a thread is started, the priority is the one the thread was created with.
+// Platforms without a feature ignore it (ThreadX schedules by priority only and runs on one core).
+struct ThreadProfile
+{
+    SchedPolicy policy = SchedPolicy::Default;
+    uint64_t cpuMask = 0;       // cores the thread may run on, 0 = no restriction
+    bool lockMemory = false;    // lock all current and future pages of the process into RAM
+    size_t prefaultStack = 0;   // bytes of stack touched before the task runs, so it never page faults
+
+    constexpr bool operator==(const ThreadProfile&) const = default;
+};
+
 class OSAL
 {
 public:
@@ -31,6 +53,9 @@ public:
     static void println(const char* msg) { instance().printlnImpl(msg); }
     static void eprint(const char* emsg) { instance().eprintImpl(emsg); }
     static void eprintln(const char* emsg) { instance().eprintlnImpl(emsg); }
+    // writes all parts back to back, with a single system call where the platform supports it
+    static void printv(std::span<const std::string_view> parts) { instance().printvImpl(parts); }
+    static void eprintv(std::span<const std::string_view> parts) { instance().eprintvImpl(parts); }
     static void setConsoleColor(ConsoleColor col) { instance().setConsoleColorImpl(col); }
 
     // --- Time ---
@@ -63,12 +88,24 @@ public:
     public:
         virtual ~Mutex() = default;
         virtual void lock() = 0;
+        virtual bool try_lock() = 0;
         virtual void unlock() = 0;
     private:
         struct AllocInfo;
     };
     static void createMutex(IPolymorphic<Mutex>& mutex) { instance().createMutexImpl(mutex); }
 
+    // --- Semaphore ---
+    class Semaphore
+    {
+    public:
+        virtual ~Semaphore() = default;
+        virtual void acquire() = 0;
+        virtual bool tryAcquire() = 0;
+        virtual void release() = 0;
+    };
+    static void createSemaphore(IPolymorphic<Semaphore>& semaphore) { instance().createSemaphoreImpl(semaphore); }
+
     // --- Thread ---
     class Thread
     {
@@ -77,11 +114,16 @@ public:
         virtual bool start() = 0;
         virtual void shutdown() = 0;
         virtual bool setPriority(int prio, int policy = 0) = 0;
+
+        // takes effect on the next start()
+        void setProfile(const ThreadProfile& profile) { m_profile = profile; }
+        const ThreadProfile& profile() const { return m_profile; }
     protected: 
         const char* m_name;
         int m_prio;
         std::span<std::byte> m_stack;
         std::function<void()> m_task;
+        ThreadProfile m_profile;
     private:
         void setName(const char* name) { m_name = name; }
         void setPrio(int prio) { m_prio = prio; }
@@ -104,17 +146,100 @@ public:
     class CyclicThread
     {
     public:
+        // wakeup latency and execution time of every cycle, readable while the thread runs
+        struct Statistics
+        {
+            CycleStatistic::Snapshot latency;
+            CycleStatistic::Snapshot execution;
+            uint64_t cycles;
+            uint64_t overruns;  // cycles that ended after the next one was due
+            uint64_t skipped;   // cycles dropped by OverrunPolicy::Skip
+        };
+
         virtual ~CyclicThread() = default;
         virtual bool start(uint64_t cycleTime_us = 0) = 0;
         virtual void shutdown() = 0;
         virtual bool setPriority(int prio, int policy = 0) = 0;
         virtual bool isRunning() const = 0;
+
+        // takes effect on the next start()
+        void setProfile(const ThreadProfile& profile) { m_profile = profile; }
+        const ThreadProfile& profile() const { return m_profile; }
+
+        void setOverrunPolicy(const OverrunPolicy policy) { m_overrunPolicy.store(policy, std::memory_order_relaxed); }
+        OverrunPolicy overrunPolicy() const { return m_overrunPolicy.load(std::memory_order_relaxed); }
+
+        Statistics statistics() const
+        {
+            Statistics statistics{ m_latency.snapshot(), m_execution.snapshot(), 0, 0, 0 };
+            m_counterLock.read([&]() {
+                statistics.cycles = m_cycles.load();
+                statistics.overruns = m_overruns.load();
+                statistics.skipped = m_skipped.load();
+            });
+            return statistics;
+        }
+        // applied by the thread itself at the end of its next cycle
+        void resetStatistics() { m_resetRequested.store(true, std::memory_order_relaxed); }
+
     protected:
+        // Bookkeeping at the end of a cycle, called by the implementations with times in ns
+        // on their monotonic clock. Returns when the next cycle is due.
+        uint64_t completeCycle(const uint64_t due_ns, const uint64_t start_ns, const uint64_t end_ns, const uint64_t period_ns)
+        {
+            if (m_resetRequested.exchange(false, std::memory_order_relaxed)) {
+                m_latency.reset();
+                m_execution.reset();
+                m_counterLock.beginWrite();
+                m_cycles.store(0);
+                m_overruns.store(0);
+                m_skipped.store(0);
+                m_counterLock.endWrite();
+            }
+
+            m_latency.record(start_ns > due_ns ? start_ns - due_ns : 0);
+            m_execution.record(end_ns - start_ns);
+
+            uint64_t next_ns = due_ns + period_ns;
+            uint64_t missed = 0;
+            const bool overrun = end_ns > next_ns && period_ns > 0;
+            if (overrun) {
+                switch (m_overrunPolicy.load(std::memory_order_relaxed)) {
+                    case OverrunPolicy::CatchUp:
+                        break;
+                    case OverrunPolicy::Skip:
+                        missed = (end_ns - next_ns) / period_ns + 1;
+                        next_ns += missed * period_ns;
+                        break;
+                    case OverrunPolicy::Rephase:
+                        next_ns = end_ns;
+                        break;
+                }
+            }
+
+            m_counterLock.beginWrite();
+            m_cycles.add(1);
+            m_overruns.add(overrun ? 1 : 0);
+            m_skipped.add(missed);
+            m_counterLock.endWrite();
+            return next_ns;
+        }
+
         const char* m_name;
         int m_prio;
         std::span<std::byte> m_stack;
         std::function<void()> m_cyclicTask;
+        ThreadProfile m_profile;
     private:
+        CycleStatistic m_latency;
+        CycleStatistic m_execution;
+        SequenceLock m_counterLock;
+        SplitCounter m_cycles;
+        SplitCounter m_overruns;
+        SplitCounter m_skipped;
+        std::atomic<OverrunPolicy> m_overrunPolicy = OverrunPolicy::CatchUp;
+        std::atomic_bool m_resetRequested = false;
+
         void setName(const char* name) { m_name = name; }
         void setPrio(int prio) { m_prio = prio; }
         void setStack(std::span<std::byte> stack) { m_stack = stack; }
@@ -137,6 +262,7 @@ public:
     {
     public:
         using MsgType = StaticAny<8>;
+        using SlotType = LockFreeQueueSlot<MsgType>;
         virtual ~MessageQueue() = default;
         virtual bool empty() const = 0;
         virtual bool push(MsgType&& msg) = 0;
@@ -151,12 +277,18 @@ public:
     {
         instance().createMessageQueueImpl(queue, store, pool);
     }
+    // lock-free variant, messages are stored inline in the slots of the ring
+    static void createMessageQueue(IPolymorphic<MessageQueue>& queue, IObjectStore<MessageQueue::SlotType>& store, QueueProducers producers)
+    {
+        instance().createLockFreeMessageQueueImpl(queue, store, producers);
+    }
 
     struct StaticImpl;
     struct DynamicImpl
     {
         using Timer         = DynamicPolymorphic<OSAL::Timer>;
         using Mutex         = DynamicPolymorphic<OSAL::Mutex>;
+        using Semaphore     = DynamicPolymorphic<OSAL::Semaphore>;
         using Thread        = DynamicPolymorphic<OSAL::Thread>;
         using CyclicThread  = DynamicPolymorphic<OSAL::CyclicThread>;
         using MessageQueue  = DynamicPolymorphic<OSAL::MessageQueue>;
@@ -170,6 +302,8 @@ protected:
     virtual void printlnImpl(const char*) const = 0;
     virtual void eprintImpl(const char*) const = 0;
     virtual void eprintlnImpl(const char*) const = 0;
+    virtual void printvImpl(std::span<const std::string_view>) const = 0;
+    virtual void eprintvImpl(std::span<const std::string_view>) const = 0;
     virtual void setConsoleColorImpl(ConsoleColor) const = 0;
     virtual uint64_t monotonicTimeImpl() const = 0;
     virtual Timestamp currentTimeImpl() const = 0;
@@ -177,9 +311,11 @@ protected:
     virtual bool sleepUntilImpl(uint64_t) const = 0;
     virtual void createTimerImpl(IPolymorphic<Timer>&) const = 0;
     virtual void createMutexImpl(IPolymorphic<Mutex>&) const = 0;
+    virtual void createSemaphoreImpl(IPolymorphic<Semaphore>&) const = 0;
     virtual void createThreadImpl(IPolymorphic<Thread>&) const = 0;
     virtual void createCyclicThreadImpl(IPolymorphic<CyclicThread>&) const = 0;
     virtual void createMessageQueueImpl(IPolymorphic<MessageQueue>&, IObjectStore<MessageQueue::MsgType*>&, IPool&) const = 0;
+    virtual void createLockFreeMessageQueueImpl(IPolymorphic<MessageQueue>&, IObjectStore<MessageQueue::SlotType>&, QueueProducers) const = 0;
 
 private:
     // --- Singleton instance ---
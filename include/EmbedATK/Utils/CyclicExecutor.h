@@ -0,0 +1,210 @@
+#pragma once
+
+#include "Thread.h"
+
+#include <numeric>
+
+namespace Utils {
+
+    // One task of a cyclic executor: runs every Divider-th base tick, starting at tick Phase.
+    // Budget_us is the execution time the task may use per run, 0 = not accounted.
+    template<auto Task, uint32_t Divider, uint32_t Phase = 0, uint64_t Budget_us = 0>
+    requires is_task_v<decltype(Task)> && (Divider > 0) && (Phase < Divider)
+    struct CyclicTask
+    {
+        inline static constexpr auto TASK = Task;
+        inline static constexpr uint32_t DIVIDER = Divider;
+        inline static constexpr uint32_t PHASE = Phase;
+        inline static constexpr uint64_t BUDGET_US = Budget_us;
+    };
+
+    template<typename... Tasks>
+    struct CyclicTasks {};
+
+    // timing of a task without its function, usable in constant evaluation
+    struct CyclicTaskTiming
+    {
+        uint32_t divider;
+        uint32_t phase;
+        uint64_t budget_us;
+    };
+
+    namespace detail {
+
+        template<size_t N>
+        consteval uint64_t hyperperiod(const std::array<CyclicTaskTiming, N>& tasks)
+        {
+            uint64_t period = 1;
+            for (const auto& task : tasks) {
+                period = std::lcm(period, static_cast<uint64_t>(task.divider));
+            }
+            return period;
+        }
+
+        // rate monotonic: shorter period first, declaration order among equal periods
+        template<size_t N>
+        consteval std::array<size_t, N> rateMonotonicOrder(const std::array<CyclicTaskTiming, N>& tasks)
+        {
+            // insertion sort, stable_sort is not constexpr
+            std::array<size_t, N> order{};
+            for (size_t i = 0; i < N; ++i) {
+                size_t j = i;
+                for (; j > 0 && tasks[order[j - 1]].divider > tasks[i].divider; --j) {
+                    order[j] = order[j - 1];
+                }
+                order[j] = i;
+            }
+            return order;
+        }
+
+        template<size_t N>
+        consteval bool hasBudgets(const std::array<CyclicTaskTiming, N>& tasks)
+        {
+            return std::ranges::any_of(tasks, [](const CyclicTaskTiming& task) { return task.budget_us > 0; });
+        }
+
+        // longest hyperperiod the budgets are checked over, bounds the compile time work
+        inline constexpr uint64_t MAX_CHECKED_HYPERPERIOD = 1 << 16;
+
+        // largest sum of budgets that falls on a single base tick over one hyperperiod,
+        // 0 if the hyperperiod is too long to be walked
+        template<size_t N>
+        consteval uint64_t worstTickBudget(const std::array<CyclicTaskTiming, N>& tasks)
+        {
+            const uint64_t period = hyperperiod(tasks);
+            if (!hasBudgets(tasks) || period > MAX_CHECKED_HYPERPERIOD)
+                return 0;
+
+            uint64_t worst = 0;
+            for (uint64_t tick = 0; tick < period; ++tick) {
+                uint64_t budget = 0;
+                for (const auto& task : tasks) {
+                    if (tick % task.divider == task.phase)
+                        budget += task.budget_us;
+                }
+                worst = std::max(worst, budget);
+            }
+            return worst;
+        }
+
+    }
+
+    // Runs many cyclic tasks on one OSAL::CyclicThread that ticks every BaseTick_us, instead of
+    // one thread and stack per task. The order within a tick is rate monotonic and fixed at compile
+    // time, phases spread slow tasks over different ticks. The schedule is checked at compile time:
+    // the budgets due on any tick of the hyperperiod have to fit into one base tick. The check walks
+    // the whole hyperperiod, so with budgets it may be at most MAX_CHECKED_HYPERPERIOD ticks long.
+    //   Utils::CyclicExecutor<OSAL::StaticImpl::CyclicThread, "io", 16384, 80, 1000, Utils::CyclicTasks<
+    //       Utils::CyclicTask<&readInputs, 1>,
+    //       Utils::CyclicTask<&control, 2, 0, 300>,
+    //       Utils::CyclicTask<&diagnostics, 100, 1>>> executor;
+    template<IsStaticPolymorphic Thread, StringLiteral Name, size_t StackSize, int Prio, uint64_t BaseTick_us, typename Schedule, ThreadProfile Profile = ThreadProfile{}>
+    requires std::is_base_of_v<IPolymorphic<OSAL::CyclicThread>, Thread> && (BaseTick_us > 0)
+    class CyclicExecutor;
+
+    template<IsStaticPolymorphic Thread, StringLiteral Name, size_t StackSize, int Prio, uint64_t BaseTick_us, typename... Tasks, ThreadProfile Profile>
+    class CyclicExecutor<Thread, Name, StackSize, Prio, BaseTick_us, CyclicTasks<Tasks...>, Profile>
+    {
+        template<size_t I>
+        using Task = std::tuple_element_t<I, std::tuple<Tasks...>>;
+
+    public:
+        static constexpr size_t TASKS = sizeof...(Tasks);
+        static constexpr uint64_t BASE_TICK_US = BaseTick_us;
+        static constexpr std::array<CyclicTaskTiming, TASKS> TIMING{ CyclicTaskTiming{ Tasks::DIVIDER, Tasks::PHASE, Tasks::BUDGET_US }... };
+        static constexpr uint64_t HYPERPERIOD = detail::hyperperiod(TIMING);
+        static constexpr uint64_t MAX_CHECKED_HYPERPERIOD = detail::MAX_CHECKED_HYPERPERIOD;
+        static constexpr std::array<size_t, TASKS> ORDER = detail::rateMonotonicOrder(TIMING);
+        static constexpr uint64_t WORST_TICK_BUDGET_US = detail::worstTickBudget(TIMING);
+
+        static_assert(TASKS > 0, "executor needs at least one task");
+        static_assert(!detail::hasBudgets(TIMING) || HYPERPERIOD <= MAX_CHECKED_HYPERPERIOD, "hyperperiod of the task dividers is too long to check the budgets at compile time, "
+            "use dividers with a smaller common multiple or no budgets");
+        static_assert(WORST_TICK_BUDGET_US <= BASE_TICK_US, "task budgets due on one tick exceed the base tick");
+
+        struct TaskStatistics
+        {
+            CycleStatistic::Snapshot execution;
+            uint64_t budgetOverruns;
+        };
+
+        CyclicExecutor()
+        {
+            OSAL::createCyclicThread(m_thread, Name, Prio, m_stackBuff, &CyclicExecutor::tick, this);
+            m_thread.get()->setProfile(Profile);
+        }
+
+        ~CyclicExecutor()
+        {
+            if (isRunning()) {
+                shutdown();
+            }
+        }
+
+        CyclicExecutor(const CyclicExecutor&) = delete;
+        CyclicExecutor& operator=(const CyclicExecutor&) = delete;
+
+        // every task starts over at its phase
+        bool start()
+        {
+            for (size_t i = 0; i < TASKS; ++i) {
+                m_countdown[i] = TIMING[i].phase;
+            }
+            return m_thread.get()->start(BASE_TICK_US);
+        }
+
+        void shutdown() { m_thread.get()->shutdown(); }
+        bool isRunning() const { return m_thread.get()->isRunning(); }
+
+        // whole ticks, as measured by the cyclic thread
+        OSAL::CyclicThread::Statistics statistics() const { return m_thread.get()->statistics(); }
+        OSAL::CyclicThread& thread() { return *m_thread.get(); }
+
+        TaskStatistics taskStatistics(const size_t index) const
+        {
+            TaskStatistics statistics{ m_execution[index].snapshot(), 0 };
+            m_budgetLock.read([&]() { statistics.budgetOverruns = m_budgetOverruns[index].load(); });
+            return statistics;
+        }
+
+    private:
+        void tick()
+        {
+            [this]<size_t... K>(std::index_sequence<K...>) {
+                (runTask<ORDER[K]>(), ...);
+            }(std::make_index_sequence<TASKS>{});
+        }
+
+        template<size_t I>
+        void runTask()
+        {
+            if (m_countdown[I] != 0) {
+                m_countdown[I]--;
+                return;
+            }
+            m_countdown[I] = Task<I>::DIVIDER - 1;
+
+            const uint64_t start = OSAL::monotonicTime();
+            Task<I>::TASK();
+            const uint64_t elapsed = OSAL::monotonicTime() - start;
+
+            m_execution[I].record(elapsed * 1000);
+            if constexpr (Task<I>::BUDGET_US > 0) {
+                if (elapsed > Task<I>::BUDGET_US) {
+                    m_budgetLock.beginWrite();
+                    m_budgetOverruns[I].add(1);
+                    m_budgetLock.endWrite();
+                }
+            }
+        }
+
+        StaticBuffer<StackSize, alignof(std::max_align_t)> m_stackBuff;
+        Thread m_thread;
+
+        std::array<uint32_t, TASKS> m_countdown{};
+        std::array<CycleStatistic, TASKS> m_execution;
+        SequenceLock m_budgetLock;
+        std::array<SplitCounter, TASKS> m_budgetOverruns;
+    };
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EmbedATK/OSAL/OSAL.h"
+#include "EmbedATK/OSAL/ConsumerWaiter.h"
 
 namespace Utils {
 
@@ -10,11 +11,15 @@ namespace Utils {
     {
         inline static constexpr size_t SIZE = Size;
 
-        StaticBlockPool<Size, allocData<OSAL::MessageQueue::MsgType>()> queuePool;
+        // producers allocate concurrently, so both pools have to be thread-safe
+        using QueuePool = ConcurrentBlockPool<Size, allocData<OSAL::MessageQueue::MsgType>()>;
+        using DataPool  = ConcurrentBlockPool<Size, allocData<T>()>;
+
+        QueuePool queuePool;
         StaticObjectStore<OSAL::MessageQueue::MsgType*, Size> queueStore;
         Queue queue;
 
-        StaticBlockPool<Size, allocData<T>()> dataPool;
+        DataPool dataPool;
     };
 
     template <typename T>
@@ -39,8 +44,8 @@ namespace Utils {
     requires std::is_move_constructible_v<T>
     static constexpr bool pushStaticMessageQueue(Queue& queue, T&& msg)
     {
-        if (!queue.dataPool.hasSpace()) return false;
-        T* ptr = queue.dataPool.template construct<T>(std::move(msg));
+        T* ptr = queue.dataPool.template tryConstruct<T>(std::move(msg));
+        if (!ptr) return false;
         return queue.queue.get()->push(OSAL::MessageQueue::MsgType(std::in_place_type<T*>, ptr));
     }
 
@@ -48,8 +53,8 @@ namespace Utils {
     requires std::is_copy_constructible_v<T>
     static constexpr bool pushStaticMessageQueue(Queue& queue, const T& msg)
     {
-        if (!queue.dataPool.hasSpace()) return false;
-        T* ptr = queue.dataPool.template construct<T>(msg);
+        T* ptr = queue.dataPool.template tryConstruct<T>(msg);
+        if (!ptr) return false;
         return queue.queue.get()->push(OSAL::MessageQueue::MsgType(std::in_place_type<T*>, ptr));
     }
 
@@ -58,8 +63,8 @@ namespace Utils {
     static constexpr bool pushManyStaticMessageQueue(Queue& queue, IQueue<T>&& data)
     {
         for (T& msg : data) {
-            if (!queue.dataPool.hasSpace()) return false;
-            T* ptr = queue.dataPool.template construct<T>(std::move(msg));
+            T* ptr = queue.dataPool.template tryConstruct<T>(std::move(msg));
+            if (!ptr) return false;
             if (!queue.queue.get()->push(OSAL::MessageQueue::MsgType(std::in_place_type<T*>, ptr))) {
                 return false;
             }
@@ -73,8 +78,8 @@ namespace Utils {
     static constexpr bool pushManyStaticMessageQueue(Queue& queue, const IQueue<T>& data)
     {
         for (const T& msg : data) {
-            if (!queue.dataPool.hasSpace()) return false;
-            T* ptr = queue.dataPool.template construct<T>(msg);
+            T* ptr = queue.dataPool.template tryConstruct<T>(msg);
+            if (!ptr) return false;
             if (!queue.queue.get()->push(OSAL::MessageQueue::MsgType(std::in_place_type<T*>, ptr))) {
                 return false;
             }
@@ -85,8 +90,8 @@ namespace Utils {
     template<typename T, IsStaticMessageQueue Queue, typename ...Args>
     static constexpr bool emplaceStaticMessageQueue(Queue& queue, Args&&... args)
     {
-        if (!queue.dataPool.hasSpace()) return false;
-        T* ptr = queue.dataPool.template construct<T>(std::forward<Args>(args)...);
+        T* ptr = queue.dataPool.template tryConstruct<T>(std::forward<Args>(args)...);
+        if (!ptr) return false;
         return queue.queue.get()->push(OSAL::MessageQueue::MsgType(std::in_place_type<T*>, ptr));
     }
 
@@ -112,10 +117,13 @@ namespace Utils {
             return false;
         }
 
+        // blocks flow back to the pool in one batch when the magazine goes out of scope
+        typename Queue::DataPool::template Magazine<N> magazine(queue.dataPool);
+
         data.clear();
-        for (OSAL::MessageQueue::MsgType& ptr : localQueue) {
+        for (OSAL::MessageQueue::MsgType& ptr : localQueue.fast()) {
             data.push(std::move(*ptr.asUnchecked<T*>()));
-            queue.dataPool.destroy(ptr.asUnchecked<T*>());
+            magazine.destroy(ptr.asUnchecked<T*>());
         }
         return true;
     }
@@ -129,10 +137,126 @@ namespace Utils {
             return false;
         }
 
+        // blocks flow back to the pool in one batch when the magazine goes out of scope
+        typename Queue::DataPool::template Magazine<N> magazine(queue.dataPool);
+
         data.clear();
-        for (OSAL::MessageQueue::MsgType& ptr : localQueue) {
+        for (OSAL::MessageQueue::MsgType& ptr : localQueue.fast()) {
             data.push(std::move(*ptr.asUnchecked<T*>()));
-            queue.dataPool.destroy(ptr.asUnchecked<T*>());
+            magazine.destroy(ptr.asUnchecked<T*>());
+        }
+        return true;
+    }
+
+    // Typed variant: messages are stored directly in the slots of a lock-free ring,
+    // no pool allocation and no pointer chase per message. Single consumer only.
+    template<typename T, size_t Size, QueueProducers Producers = QueueProducers::Multi>
+    struct StaticTypedMessageQueue
+    {
+        inline static constexpr size_t SIZE = Size;
+
+        StaticLockFreeQueue<T, Size, Producers> queue;
+        ConsumerWaiter<OSAL::StaticImpl::Semaphore> waiter;
+    };
+
+    template <typename T>
+    struct is_static_typed_message_queue : std::false_type {};
+
+    template<typename T, size_t Size, QueueProducers Producers>
+    struct is_static_typed_message_queue<Utils::StaticTypedMessageQueue<T, Size, Producers>> : std::true_type {};
+
+    template <typename T>
+    inline constexpr bool is_static_typed_message_queue_v = is_static_typed_message_queue<T>::value;
+
+    template <typename T>
+    concept IsStaticTypedMessageQueue = is_static_typed_message_queue_v<T>;
+
+    template<IsStaticTypedMessageQueue Queue>
+    static constexpr void setupStaticMessageQueue(Queue& queue)
+    {
+        OSAL::createSemaphore(queue.waiter.semaphore());
+    }
+
+    template<IsStaticTypedMessageQueue Queue, typename T>
+    requires std::is_move_constructible_v<T>
+    static constexpr bool pushStaticMessageQueue(Queue& queue, T&& msg)
+    {
+        if (!queue.queue.push(std::move(msg))) return false;
+        queue.waiter.notify();
+        return true;
+    }
+
+    template<IsStaticTypedMessageQueue Queue, typename T>
+    requires std::is_copy_constructible_v<T>
+    static constexpr bool pushStaticMessageQueue(Queue& queue, const T& msg)
+    {
+        if (!queue.queue.push(msg)) return false;
+        queue.waiter.notify();
+        return true;
+    }
+
+    template<IsStaticTypedMessageQueue Queue, typename T>
+    requires std::is_move_constructible_v<T>
+    static constexpr bool pushManyStaticMessageQueue(Queue& queue, IQueue<T>&& data)
+    {
+        if (!queue.queue.pushMany(std::move(data))) return false;
+        queue.waiter.notify();
+        data.clear();
+        return true;
+    }
+
+    template<IsStaticTypedMessageQueue Queue, typename T>
+    requires std::is_copy_constructible_v<T>
+    static constexpr bool pushManyStaticMessageQueue(Queue& queue, const IQueue<T>& data)
+    {
+        if (!queue.queue.pushMany(data)) return false;
+        queue.waiter.notify();
+        return true;
+    }
+
+    template<typename T, IsStaticTypedMessageQueue Queue, typename ...Args>
+    static constexpr bool emplaceStaticMessageQueue(Queue& queue, Args&&... args)
+    {
+        if (!queue.queue.emplace(std::forward<Args>(args)...)) return false;
+        queue.waiter.notify();
+        return true;
+    }
+
+    template<typename T, IsStaticTypedMessageQueue Queue>
+    static constexpr std::optional<T> popStaticMessageQueue(Queue& queue)
+    {
+        while (true) {
+            if (auto msg = queue.queue.pop()) 
+                return msg;
+            queue.waiter.wait([&queue]() { return queue.queue.empty(); });
+        }
+    }
+
+    template<typename T, IsStaticTypedMessageQueue Queue>
+    static constexpr std::optional<T> tryPopStaticMessageQueue(Queue& queue)
+    {
+        return queue.queue.pop();
+    }
+
+    template<IsStaticTypedMessageQueue Queue, typename T, size_t N>
+    static constexpr bool tryPopAvailStaticMessageQueue(Queue& queue, StaticQueue<T, N>& data)
+    {
+        // like the pool backed queue the batch is only replaced once there is something to pop
+        bool cleared = false;
+        return queue.queue.consume([&data, &cleared](T&& msg) {
+            if (!cleared) {
+                data.clear();
+                cleared = true;
+            }
+            data.push(std::move(msg));
+        }, N) > 0;
+    }
+
+    template<IsStaticTypedMessageQueue Queue, typename T, size_t N>
+    static constexpr bool popAvailStaticMessageQueue(Queue& queue, StaticQueue<T, N>& data)
+    {
+        while (!tryPopAvailStaticMessageQueue(queue, data)) {
+            queue.waiter.wait([&queue]() { return queue.queue.empty(); });
         }
         return true;
     }
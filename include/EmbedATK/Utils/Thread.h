@@ -11,7 +11,8 @@ namespace Utils {
     template<typename T>
     inline constexpr bool is_task_v = std::invocable<T> && std::is_same_v<std::invoke_result_t<T>, void>;
 
-    template<IsStaticPolymorphic Thread, StringLiteral Name, size_t StackSize, int Prio, auto Task = nullptr, uint64_t CycleTime_us = 0>
+    // Profile carries the real-time setup, e.g. ThreadProfile{ .policy = SchedPolicy::Fifo, .cpuMask = 0b10, .lockMemory = true }
+    template<IsStaticPolymorphic Thread, StringLiteral Name, size_t StackSize, int Prio, auto Task = nullptr, uint64_t CycleTime_us = 0, ThreadProfile Profile = ThreadProfile{}>
     requires
         (Task == nullptr || (is_task_v<decltype(Task)>)) &&
         (
@@ -24,6 +25,7 @@ namespace Utils {
         inline static constexpr int PRIO = Prio;
         inline static constexpr bool IS_CYCLIC = std::is_base_of_v<IPolymorphic<OSAL::CyclicThread>, Thread>;
         inline static constexpr uint64_t CYCLE_TIME_US = CycleTime_us;
+        inline static constexpr ThreadProfile PROFILE = Profile;
         inline static constexpr TaskFunction TASK = Task;
         
         StaticBuffer<StackSize, alignof(std::max_align_t)> stackBuff;
@@ -53,8 +55,8 @@ namespace Utils {
     template <typename T>
     struct is_static_thread : std::false_type {};
 
-    template<IsStaticPolymorphic Thread, StringLiteral Name, size_t StackSize, int Prio, auto Task, uint64_t CycleTime_us>
-    struct is_static_thread<Utils::StaticThread<Thread, Name, StackSize, Prio, Task, CycleTime_us>> : std::true_type {};
+    template<IsStaticPolymorphic Thread, StringLiteral Name, size_t StackSize, int Prio, auto Task, uint64_t CycleTime_us, ThreadProfile Profile>
+    struct is_static_thread<Utils::StaticThread<Thread, Name, StackSize, Prio, Task, CycleTime_us, Profile>> : std::true_type {};
 
     template <typename T>
     inline constexpr bool is_static_thread_v = is_static_thread<T>::value;
@@ -76,6 +78,7 @@ namespace Utils {
                 thread.stackBuff,
                 thread.TASK
             );
+            thread.thread.get()->setProfile(thread.PROFILE);
 
             if (autoStart) {
                 thread.thread.get()->start(thread.CYCLE_TIME_US);
@@ -90,6 +93,7 @@ namespace Utils {
                 thread.stackBuff,
                 thread.TASK
             );
+            thread.thread.get()->setProfile(thread.PROFILE);
 
             if (autoStart) {
                 thread.thread.get()->start();
@@ -113,6 +117,7 @@ namespace Utils {
                 std::forward<Callable>(func), 
                 std::forward<Args>(args)...
             );
+            thread.thread.get()->setProfile(thread.PROFILE);
 
             if (autoStart) {
                 thread.thread.get()->start(thread.CYCLE_TIME_US);
@@ -128,6 +133,7 @@ namespace Utils {
                 std::forward<Callable>(func), 
                 std::forward<Args>(args)...
             );
+            thread.thread.get()->setProfile(thread.PROFILE);
 
             if (autoStart) {
                 thread.thread.get()->start();
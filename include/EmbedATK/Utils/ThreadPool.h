@@ -0,0 +1,371 @@
+#pragma once
+
+#include "Thread.h"
+
+#include "EmbedATK/Container/WorkStealingDeque.h"
+
+namespace Utils {
+
+    // Fixed set of OSAL threads sharing work through per-worker Chase-Lev deques.
+    // Tasks live in a statically allocated pool of TaskSize byte slots, nothing is allocated at runtime.
+    // submit() can be called from any thread and goes through a shared injection deque, parallelFor()
+    // splits its range recursively and pushes the halves onto the deque of the worker running it,
+    // idle workers steal from the top of the others. Threads waiting for a result help with the work.
+    // When the task storage or a deque is full the work is run inline by the caller instead of failing.
+    //   Utils::ThreadPool<4, 64> pool;
+    //   pool.start();
+    //   auto done = pool.submit([&] { compress(log); });
+    //   pool.parallelFor(0, slaves.size(), [&](size_t i) { process(slaves[i]); });
+    //   done.wait();
+    template<size_t Workers, size_t QueueDepth, size_t StackSize = 16384, int Prio = 0, size_t TaskSize = 48, ThreadProfile Profile = ThreadProfile{}>
+    requires (Workers > 0) && (QueueDepth > 0)
+    class ThreadPool
+    {
+        static constexpr size_t NO_WORKER = Workers;
+        static constexpr size_t INJECTION = Workers;
+
+        struct Job
+        {
+            using Invoke = void(*)(ThreadPool&, Job&, size_t worker);
+
+            Invoke invoke;
+            std::atomic_uint32_t refs;  // pool until the job ran, plus the future if there is one
+            std::atomic_bool done = false;
+            alignas(std::max_align_t) std::array<std::byte, TaskSize> storage;
+
+            template<typename T>
+            T* as() noexcept { return std::launder(reinterpret_cast<T*>(storage.data())); }
+        };
+
+        struct ForState
+        {
+            void(*call)(const void* fn, size_t begin, size_t end);
+            const void* fn;
+            size_t grain;
+            std::atomic_size_t remaining;
+        };
+
+        struct Range
+        {
+            ForState* state;
+            size_t begin;
+            size_t end;
+        };
+
+    public:
+        static constexpr size_t WORKERS = Workers;
+        static constexpr size_t QUEUE_DEPTH = QueueDepth;
+        // every deque full plus the jobs being run and the ones held by futures
+        static constexpr size_t MAX_TASKS = (Workers + 1) * QueueDepth;
+
+        // Completion of a submitted task, must not outlive the pool.
+        class Future
+        {
+        public:
+            Future() = default;
+            ~Future() { reset(); }
+
+            Future(const Future&) = delete;
+            Future& operator=(const Future&) = delete;
+
+            Future(Future&& other) noexcept
+                : m_pool(std::exchange(other.m_pool, nullptr)), m_job(std::exchange(other.m_job, nullptr)) {}
+
+            Future& operator=(Future&& other) noexcept
+            {
+                if (this != &other) {
+                    reset();
+                    m_pool = std::exchange(other.m_pool, nullptr);
+                    m_job = std::exchange(other.m_job, nullptr);
+                }
+                return *this;
+            }
+
+            bool valid() const noexcept { return m_pool != nullptr; }
+            bool ready() const noexcept { return m_job == nullptr || m_job->done.load(std::memory_order_acquire); }
+
+            void wait()
+            {
+                if (!valid()) throw std::logic_error("future has no task");
+                m_pool->waitUntil([this]() { return ready(); });
+            }
+
+        private:
+            Future(ThreadPool* pool, Job* job) : m_pool(pool), m_job(job) {}
+
+            void reset() noexcept
+            {
+                if (m_job) m_pool->releaseJob(*m_job);
+                m_pool = nullptr;
+                m_job = nullptr;
+            }
+
+            ThreadPool* m_pool = nullptr;
+            Job* m_job = nullptr;
+
+            friend class ThreadPool;
+        };
+
+        ThreadPool()
+        {
+            OSAL::createMutex(m_injectionMutex);
+            OSAL::createSemaphore(m_workAvailable);
+            OSAL::createSemaphore(m_jobDone);
+            for (size_t i = 0; i < Workers; ++i) {
+                OSAL::createThread(m_threads[i], "eatk-pool", Prio, m_stackBuffs[i], &ThreadPool::workerLoop, this, i);
+                m_threads[i].get()->setProfile(Profile);
+            }
+        }
+
+        ~ThreadPool()
+        {
+            shutdown();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        bool start()
+        {
+            if (m_running.exchange(true)) return false;
+            bool started = true;
+            for (auto& thread : m_threads) {
+                started &= thread.get()->start();
+            }
+            return started;
+        }
+
+        // lets the workers finish all queued work, then joins them
+        void shutdown()
+        {
+            if (m_running.exchange(false)) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                for (size_t i = 0; i < Workers; ++i) {
+                    m_workAvailable.get()->release();
+                }
+                for (auto& thread : m_threads) {
+                    thread.get()->shutdown();
+                }
+            }
+            // never started or a worker was terminated, nothing may be left behind
+            while (Job* job = findJob(NO_WORKER)) {
+                run(*job, NO_WORKER);
+            }
+        }
+
+        bool isRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+        template<typename Task>
+        requires is_task_v<std::decay_t<Task>>
+        Future submit(Task&& task)
+        {
+            using Callable = std::decay_t<Task>;
+            static_assert(sizeof(Callable) <= TaskSize && alignof(Callable) <= alignof(std::max_align_t), "task does not fit into a task slot");
+
+            Job* job = allocateJob(2);
+            if (!job) {
+                std::invoke(task);
+                return Future(this, nullptr);
+            }
+
+            std::construct_at(job->template as<Callable>(), std::forward<Task>(task));
+            job->invoke = [](ThreadPool&, Job& job, size_t) {
+                Callable* callable = job.template as<Callable>();
+                std::invoke(*callable);
+                std::destroy_at(callable);
+            };
+
+            if (!schedule(*job, NO_WORKER)) {
+                run(*job, NO_WORKER);
+            }
+            return Future(this, job);
+        }
+
+        // Calls fn(i) for every i in [begin, end) and returns when all calls are done.
+        // grain is the number of indices that are never split further, 0 picks one so that
+        // every worker gets a few pieces to steal.
+        template<typename Fn>
+        requires std::invocable<const Fn&, size_t>
+        void parallelFor(const size_t begin, const size_t end, const Fn& fn, size_t grain = 0)
+        {
+            if (begin >= end) return;
+            if (grain == 0) grain = std::max<size_t>(1, (end - begin) / (4 * Workers));
+
+            ForState state{
+                [](const void* fn, size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        std::invoke(*static_cast<const Fn*>(fn), i);
+                    }
+                },
+                &fn, grain, end - begin
+            };
+
+            runRange({ &state, begin, end }, NO_WORKER);
+            waitUntil([&state]() { return state.remaining.load(std::memory_order_acquire) == 0; });
+        }
+
+    private:
+        static_assert(sizeof(Range) <= TaskSize, "task slots are too small for parallelFor");
+
+        using JobPool = ConcurrentBlockPool<MAX_TASKS, allocData<Job>()>;
+        using Deque = StaticWorkStealingDeque<Job*, QueueDepth>;
+
+        // ----------------------------------------
+        // --- scheduling
+        // ----------------------------------------
+        Job* allocateJob(const uint32_t refs) noexcept
+        {
+            Job* job = m_jobs.template tryConstruct<Job>();
+            if (job) job->refs.store(refs, std::memory_order_relaxed);
+            return job;
+        }
+
+        void releaseJob(Job& job) noexcept
+        {
+            if (job.refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                m_jobs.destroy(&job);
+            }
+        }
+
+        // workers push onto their own deque, everybody else onto the shared injection deque
+        bool schedule(Job& job, const size_t worker)
+        {
+            bool pushed;
+            if (worker != NO_WORKER) {
+                pushed = m_deques[worker].push(&job);
+            }
+            else {
+                m_injectionMutex.get()->lock();
+                pushed = m_deques[INJECTION].push(&job);
+                m_injectionMutex.get()->unlock();
+            }
+
+            if (pushed) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_sleeping.load(std::memory_order_relaxed) > 0) {
+                    m_workAvailable.get()->release();
+                }
+            }
+            return pushed;
+        }
+
+        // own deque first, then the injection deque, then the other workers starting at the next one
+        Job* findJob(const size_t worker) noexcept
+        {
+            if (worker != NO_WORKER) {
+                if (auto job = m_deques[worker].pop()) return *job;
+            }
+            if (auto job = m_deques[INJECTION].steal()) return *job;
+
+            const size_t first = worker == NO_WORKER ? 0 : worker + 1;
+            for (size_t i = 0; i < Workers; ++i) {
+                const size_t victim = (first + i) % Workers;
+                if (victim == worker) continue;
+                if (auto job = m_deques[victim].steal()) return *job;
+            }
+            return nullptr;
+        }
+
+        bool hasWork() const noexcept
+        {
+            return std::ranges::any_of(m_deques, [](const Deque& deque) { return !deque.empty(); });
+        }
+
+        void run(Job& job, const size_t worker)
+        {
+            job.invoke(*this, job, worker);
+            job.done.store(true, std::memory_order_release);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            for (uint32_t waiting = m_waiting.load(std::memory_order_relaxed); waiting > 0; --waiting) {
+                m_jobDone.get()->release();
+            }
+            releaseJob(job);
+        }
+
+        // splits off the upper half as long as the range is larger than the grain and runs the rest
+        void runRange(Range range, const size_t worker)
+        {
+            ForState& state = *range.state;
+            while (range.end - range.begin > state.grain) {
+                Job* job = allocateJob(1);
+                if (!job) break;
+
+                const size_t mid = range.begin + (range.end - range.begin) / 2;
+                std::construct_at(job->template as<Range>(), Range{ &state, mid, range.end });
+                job->invoke = [](ThreadPool& pool, Job& job, size_t worker) {
+                    pool.runRange(*job.template as<Range>(), worker);
+                };
+
+                if (!schedule(*job, worker)) {
+                    releaseJob(*job);
+                    break;
+                }
+                range.end = mid;
+            }
+
+            state.call(state.fn, range.begin, range.end);
+            // last access to the state, the waiting thread may return right after
+            state.remaining.fetch_sub(range.end - range.begin, std::memory_order_acq_rel);
+        }
+
+        // ----------------------------------------
+        // --- threads
+        // ----------------------------------------
+        void workerLoop(const size_t worker)
+        {
+            while (true) {
+                if (Job* job = findJob(worker)) {
+                    run(*job, worker);
+                    continue;
+                }
+                if (!m_running.load(std::memory_order_relaxed)) break;
+
+                // pairs with the fence in schedule(): either the pusher sees the sleeper or the sleeper sees the job
+                m_sleeping.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_running.load(std::memory_order_relaxed) && !hasWork()) {
+                    m_workAvailable.get()->acquire();
+                }
+                m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        // helps with any queued work until the condition holds, sleeps only if there is none
+        template<typename Condition>
+        void waitUntil(Condition&& condition)
+        {
+            while (!condition()) {
+                if (Job* job = findJob(NO_WORKER)) {
+                    run(*job, NO_WORKER);
+                    continue;
+                }
+
+                m_waiting.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!condition() && !hasWork()) {
+                    m_jobDone.get()->acquire();
+                }
+                m_waiting.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        // ----------------------------------------
+        // --- data
+        // ----------------------------------------
+        std::array<Deque, Workers + 1> m_deques;
+        JobPool m_jobs;
+
+        OSAL::StaticImpl::Mutex m_injectionMutex;
+        OSAL::StaticImpl::Semaphore m_workAvailable;
+        OSAL::StaticImpl::Semaphore m_jobDone;
+
+        std::atomic_bool m_running = false;
+        std::atomic_uint32_t m_sleeping = 0;
+        std::atomic_uint32_t m_waiting = 0;
+
+        std::array<StaticBuffer<StackSize, alignof(std::max_align_t)>, Workers> m_stackBuffs;
+        std::array<OSAL::StaticImpl::Thread, Workers> m_threads;
+    };
+
+}
@@ -0,0 +1,333 @@
+#pragma once
+
+#include "EmbedATK/OSAL/OSAL.h"
+#include "EmbedATK/Container/Intrusive.h"
+
+namespace Utils {
+
+    class ITimerWheel;
+
+    // Timer node of a timer wheel, owned by the user (typically embedded in the object it times out).
+    // Expires on a tick of the wheel and then calls its callback, on the thread advancing the wheel.
+    // A timer is linked into at most one wheel at a time and is cancelled when destroyed, through
+    // ITimerWheel::release() so a wheel shared between threads can take its lock first.
+    class WheelTimer
+    {
+    public:
+        // the wheel is passed along so the callback can re-arm timers without going through a lock
+        using Callback = void(*)(WheelTimer& timer, ITimerWheel& wheel);
+
+        constexpr WheelTimer() noexcept = default;
+        constexpr explicit WheelTimer(Callback callback, void* context = nullptr) noexcept
+            : m_callback(callback), m_context(context) {}
+        inline ~WheelTimer();
+
+        WheelTimer(const WheelTimer&) = delete;
+        WheelTimer& operator=(const WheelTimer&) = delete;
+
+        bool isArmed() const noexcept { return m_wheel.load(std::memory_order_relaxed) != nullptr; }
+        uint64_t expiry() const noexcept { return m_expiry; }
+        uint64_t period() const noexcept { return m_period; }
+
+        Callback callback() const noexcept { return m_callback; }
+        void* context() const noexcept { return m_context; }
+        void setCallback(Callback callback, void* context = nullptr) noexcept
+        {
+            m_callback = callback;
+            m_context = context;
+        }
+
+    private:
+        IntrusiveListHook<WheelTimer> m_hook;
+        // changed by the wheel only, read by the destructor without the lock of a shared wheel
+        std::atomic<ITimerWheel*> m_wheel = nullptr;
+        uint64_t m_expiry = 0;  // tick
+        uint64_t m_period = 0;  // ticks, 0 = one shot
+        size_t m_level = 0;
+        size_t m_slot = 0;
+
+        Callback m_callback = nullptr;
+        void* m_context = nullptr;
+
+        template<size_t SlotBits, size_t Levels>
+        requires (SlotBits > 0 && SlotBits <= 16) && (Levels > 0) && (SlotBits * Levels < 64)
+        friend class StaticTimerWheel;
+    };
+
+    class ITimerWheel
+    {
+    public:
+        virtual ~ITimerWheel() = default;
+
+        // ticks advanced so far
+        virtual uint64_t now() const noexcept = 0;
+        // number of armed timers
+        virtual size_t size() const noexcept = 0;
+
+        // expires ticks (at least one) from now, then every period ticks if period > 0;
+        // an armed timer is moved to the new expiry
+        virtual void arm(WheelTimer& timer, uint64_t ticks, uint64_t period = 0) = 0;
+        // returns false if the timer was not armed on this wheel, e.g. because it already expired
+        virtual bool cancel(WheelTimer& timer) noexcept = 0;
+        // cancels a timer that is destroyed while armed
+        virtual void release(WheelTimer& timer) noexcept { cancel(timer); }
+    };
+
+    inline WheelTimer::~WheelTimer()
+    {
+        if (ITimerWheel* wheel = m_wheel.load(std::memory_order_relaxed)) wheel->release(*this);
+    }
+
+    // Hierarchical timer wheel (Varghese/Lauck): Levels wheels of 2^SlotBits slots, level l has a
+    // resolution of 2^(l*SlotBits) ticks. Arming and cancelling are O(1), a tick expires one slot
+    // and every 2^SlotBits ticks moves the due slot of the next level down. Timers further away than
+    // MAX_TICKS are parked on the last level and moved again when they come up.
+    // Not thread-safe, TimerService adds the locking and the clock.
+    template<size_t SlotBits = 6, size_t Levels = 4>
+    requires (SlotBits > 0 && SlotBits <= 16) && (Levels > 0) && (SlotBits * Levels < 64)
+    class StaticTimerWheel : public ITimerWheel
+    {
+        using List = IntrusiveList<WheelTimer, &WheelTimer::m_hook>;
+
+    public:
+        static constexpr size_t SLOTS = size_t{1} << SlotBits;
+        static constexpr size_t LEVELS = Levels;
+        static constexpr uint64_t MAX_TICKS = (uint64_t{1} << (SlotBits * Levels)) - 1;
+
+        StaticTimerWheel() = default;
+        StaticTimerWheel(const StaticTimerWheel&) = delete;
+        StaticTimerWheel& operator=(const StaticTimerWheel&) = delete;
+
+        ~StaticTimerWheel()
+        {
+            const auto release = [](List& list) {
+                while (WheelTimer* timer = list.pop_front()) {
+                    timer->m_wheel.store(nullptr, std::memory_order_relaxed);
+                }
+            };
+            for (auto& level : m_wheel) {
+                std::ranges::for_each(level, release);
+            }
+            release(m_expiring);
+        }
+
+        uint64_t now() const noexcept override { return m_tick; }
+        size_t size() const noexcept override { return m_size; }
+
+        void arm(WheelTimer& timer, const uint64_t ticks, const uint64_t period = 0) override
+        {
+            const ITimerWheel* wheel = timer.m_wheel.load(std::memory_order_relaxed);
+            if (wheel != nullptr && wheel != this) throw std::logic_error("timer is armed on another wheel");
+            if (wheel) unlink(timer);
+
+            timer.m_expiry = m_tick + std::max<uint64_t>(ticks, 1);
+            timer.m_period = period;
+            timer.m_wheel.store(this, std::memory_order_relaxed);
+            link(timer);
+            m_size++;
+        }
+
+        bool cancel(WheelTimer& timer) noexcept override
+        {
+            if (timer.m_wheel.load(std::memory_order_relaxed) != this) return false;
+            unlink(timer);
+            timer.m_wheel.store(nullptr, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Advances the wheel by ticks and fires the timers that expire on the way. Timers without
+        // a callback are passed to expired(WheelTimer&) instead. Returns the number of fired timers.
+        template<typename Expired = std::nullptr_t>
+        size_t advance(uint64_t ticks, Expired&& expired = nullptr)
+        {
+            size_t fired = 0;
+            for (; ticks > 0; --ticks) {
+                if (m_size == 0) {
+                    m_tick += ticks;
+                    break;
+                }
+
+                const uint64_t tick = m_tick + 1;
+                // a level is due whenever all levels below it wrap around
+                for (size_t level = 1; level < Levels && (tick & ((uint64_t{1} << (level * SlotBits)) - 1)) == 0; ++level) {
+                    List due = std::move(m_wheel[level][(tick >> (level * SlotBits)) & MASK]);
+                    while (WheelTimer* timer = due.pop_front()) {
+                        link(*timer);
+                    }
+                }
+                m_tick = tick;
+
+                // The slot may hold timers that are not due yet, timers parked further than MAX_TICKS
+                // ahead on a single level wheel. They are linked again, the due ones are set aside
+                // first since the callbacks may cancel or re-arm any of them.
+                List slot = std::move(m_wheel[0][tick & MASK]);
+                while (WheelTimer* timer = slot.pop_front()) {
+                    if (timer->m_expiry > tick) {
+                        link(*timer);
+                    }
+                    else {
+                        timer->m_level = EXPIRING;
+                        m_expiring.push_back(*timer);
+                    }
+                }
+
+                // timers armed by the callbacks may land in this slot again, they expire a full turn later
+                while (WheelTimer* next = m_expiring.front()) {
+                    WheelTimer& timer = *next;
+                    unlink(timer);
+                    if (timer.m_period > 0) {
+                        timer.m_expiry = std::max(timer.m_expiry + timer.m_period, tick + 1);
+                        link(timer);
+                        m_size++;
+                    }
+                    else {
+                        timer.m_wheel.store(nullptr, std::memory_order_relaxed);
+                    }
+
+                    fired++;
+                    if (timer.m_callback) {
+                        timer.m_callback(timer, *this);
+                    }
+                    else if constexpr (!std::is_same_v<std::decay_t<Expired>, std::nullptr_t>) {
+                        std::invoke(expired, timer);
+                    }
+                }
+            }
+            return fired;
+        }
+
+    private:
+        static constexpr uint64_t MASK = SLOTS - 1;
+        // level of the timers that are due on the current tick
+        static constexpr size_t EXPIRING = Levels;
+
+        // the slot depends on how far the expiry is from the next tick to be processed
+        void link(WheelTimer& timer) noexcept
+        {
+            const uint64_t base = m_tick + 1;
+            const uint64_t delta = std::min(timer.m_expiry > base ? timer.m_expiry - base : 0, MAX_TICKS);
+            const size_t level = static_cast<size_t>(std::bit_width(delta | 1) - 1) / SlotBits;
+
+            timer.m_level = level;
+            timer.m_slot = static_cast<size_t>(((base + delta) >> (level * SlotBits)) & MASK);
+            m_wheel[level][timer.m_slot].push_back(timer);
+        }
+
+        // the timer stays assigned to the wheel, the callers decide about m_wheel
+        void unlink(WheelTimer& timer) noexcept
+        {
+            if (timer.m_level == EXPIRING) m_expiring.erase(timer);
+            else m_wheel[timer.m_level][timer.m_slot].erase(timer);
+            m_size--;
+        }
+
+        // ----------------------------------------
+        // --- data
+        // ----------------------------------------
+        std::array<std::array<List, SLOTS>, Levels> m_wheel;
+        List m_expiring;
+        uint64_t m_tick = 0;
+        size_t m_size = 0;
+    };
+
+    // Timer wheel behind an OSAL mutex, driven by tick() from a cyclic thread every Tick_us or
+    // faster. tick() reads the clock once and catches up on the ticks that passed, no matter how many
+    // timers are armed. Callbacks run inside tick() with the service locked, they must not call into
+    // the service but can use the wheel they get passed. Timers without callback are posted as events
+    // which one consumer thread picks up with pollExpired(), events that do not fit are counted as dropped.
+    // A timer destroyed while armed unlinks itself under the service lock, so it must not be destroyed
+    // armed by a callback of the service: cancel it through the wheel passed to the callback first.
+    //   Utils::TimerService<1000> timers;
+    //   timers.arm(mailboxTimeout, 50000);      // 50 ms, callback or event
+    //   Utils::CyclicTask<[] { timers.tick(); }, 1>
+    template<uint64_t Tick_us, size_t EventDepth = 64, size_t SlotBits = 6, size_t Levels = 4>
+    requires (Tick_us > 0)
+    class TimerService
+    {
+    public:
+        using Wheel = StaticTimerWheel<SlotBits, Levels>;
+
+        static constexpr uint64_t TICK_US = Tick_us;
+
+        // rounded up, a timer never expires early
+        static constexpr uint64_t toTicks(const uint64_t us) noexcept { return (us + Tick_us - 1) / Tick_us; }
+
+        TimerService()
+        {
+            OSAL::createMutex(m_mutex);
+        }
+
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        void arm(WheelTimer& timer, const uint64_t timeout_us, const uint64_t period_us = 0)
+        {
+            std::scoped_lock lock(*m_mutex.get());
+            m_wheel.arm(timer, toTicks(timeout_us), toTicks(period_us));
+        }
+
+        bool cancel(WheelTimer& timer)
+        {
+            std::scoped_lock lock(*m_mutex.get());
+            return m_wheel.cancel(timer);
+        }
+
+        // the first call starts the clock, returns the number of fired timers
+        size_t tick()
+        {
+            const uint64_t now = OSAL::monotonicTime();
+
+            std::scoped_lock lock(*m_mutex.get());
+            if (!m_started) {
+                m_origin = now;
+                m_started = true;
+            }
+            const uint64_t due = (now - m_origin) / Tick_us;
+            return m_wheel.advance(due - m_wheel.now(), [this](WheelTimer& timer) {
+                if (!m_events.push(&timer)) {
+                    m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        // consumer side, a single thread only
+        std::optional<WheelTimer*> pollExpired() { return m_events.pop(); }
+
+        size_t size() const
+        {
+            std::scoped_lock lock(*m_mutex.get());
+            return m_wheel.size();
+        }
+
+        uint64_t droppedEvents() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+        // cancels the timers destroyed while armed under the service lock
+        class LockedWheel : public Wheel
+        {
+        public:
+            explicit LockedWheel(OSAL::StaticImpl::Mutex& mutex) : m_mutex(mutex) {}
+
+            void release(WheelTimer& timer) noexcept override
+            {
+                std::scoped_lock lock(*m_mutex.get());
+                this->cancel(timer);
+            }
+
+        private:
+            OSAL::StaticImpl::Mutex& m_mutex;
+        };
+
+        // ----------------------------------------
+        // --- data
+        // ----------------------------------------
+        mutable OSAL::StaticImpl::Mutex m_mutex;
+        LockedWheel m_wheel{ m_mutex };
+        uint64_t m_origin = 0;
+        bool m_started = false;
+
+        StaticLockFreeQueue<WheelTimer*, EventDepth, QueueProducers::Single> m_events;
+        std::atomic_uint32_t m_dropped = 0;
+    };
+
+}
@@ -1,7 +1,14 @@
 #pragma once
 
+#include "EmbedATK/Container/String.h"
+
 struct Timestamp
 {
+    // DD.MM.YYYY, HH:MM:SS:mmm and both separated by a space
+    static constexpr size_t DATE_SIZE = 10;
+    static constexpr size_t TIME_SIZE = 12;
+    static constexpr size_t DATE_TIME_SIZE = DATE_SIZE + 1 + TIME_SIZE;
+
     uint16_t year;
     uint8_t month;
     uint8_t day;
@@ -11,53 +18,87 @@ struct Timestamp
     uint16_t millisecond;
 
     Timestamp() = default;
-    Timestamp(const std::string& timestamp)
+    constexpr Timestamp(std::string_view timestamp)
     {
-        day			= static_cast<uint16_t>(std::stoi(timestamp.substr(0, 2)));
-        month		= static_cast<uint8_t>(std::stoi(timestamp.substr(3, 2)));
-        year		= static_cast<uint8_t>(std::stoi(timestamp.substr(6, 4)));
-        hour		= static_cast<uint8_t>(std::stoi(timestamp.substr(11, 2)));
-        minute		= static_cast<uint8_t>(std::stoi(timestamp.substr(14, 2)));
-        second		= static_cast<uint8_t>(std::stoi(timestamp.substr(17, 2)));
-        millisecond	= static_cast<uint16_t>(std::stoi(timestamp.substr(20, 3)));
+        if (timestamp.size() < DATE_TIME_SIZE) throw std::invalid_argument("timestamp too short");
+
+        day			= static_cast<uint8_t>(parse(timestamp, 0, 2));
+        month		= static_cast<uint8_t>(parse(timestamp, 3, 2));
+        year		= static_cast<uint16_t>(parse(timestamp, 6, 4));
+        hour		= static_cast<uint8_t>(parse(timestamp, 11, 2));
+        minute		= static_cast<uint8_t>(parse(timestamp, 14, 2));
+        second		= static_cast<uint8_t>(parse(timestamp, 17, 2));
+        millisecond	= static_cast<uint16_t>(parse(timestamp, 20, 3));
     }
 
-    std::string dateStr() const
+    // write exactly DATE_SIZE/TIME_SIZE/DATE_TIME_SIZE characters without terminator,
+    // returns the end of the written text
+    constexpr char* formatDate(char* out) const noexcept
     {
-        std::stringstream ss;
-
-        day < 10 ? ss << '0' << (uint16_t)day : ss << (uint16_t)day;
-        ss << '.';
-        month < 10 ? ss << '0' << (uint16_t)month : ss << (uint16_t)month;
-        ss << '.';
-        ss << year;
+        out = digits(out, day, 2);
+        *out++ = '.';
+        out = digits(out, month, 2);
+        *out++ = '.';
+        return digits(out, year, 4);
+    }
 
-        return ss.str();
+    constexpr char* formatTime(char* out) const noexcept
+    {
+        out = digits(out, hour, 2);
+        *out++ = ':';
+        out = digits(out, minute, 2);
+        *out++ = ':';
+        out = digits(out, second, 2);
+        *out++ = ':';
+        return digits(out, millisecond, 3);
     }
 
-    std::string timeStr() const
+    constexpr char* formatDateTime(char* out) const noexcept
     {
-        std::stringstream ss;
+        out = formatDate(out);
+        *out++ = ' ';
+        return formatTime(out);
+    }
 
-        hour < 10 ? ss << '0' << (uint16_t)hour : ss << (uint16_t)hour;
-        ss << ':';
-        minute < 10 ? ss << '0' << (uint16_t)minute : ss << (uint16_t)minute;
-        ss << ':';
-        second < 10 ? ss << '0' << (uint16_t)second : ss << (uint16_t)second;
-        ss << ':';
-        millisecond < 100 ? millisecond < 10 ? ss << "00" << millisecond : ss << '0' << millisecond : ss << millisecond;
+    constexpr StaticString<DATE_SIZE> dateStr() const
+    {
+        StaticString<DATE_SIZE> str;
+        str.commit(static_cast<size_t>(formatDate(str.data()) - str.data()));
+        return str;
+    }
 
-        return ss.str();
+    constexpr StaticString<TIME_SIZE> timeStr() const
+    {
+        StaticString<TIME_SIZE> str;
+        str.commit(static_cast<size_t>(formatTime(str.data()) - str.data()));
+        return str;
     }
 
-    std::string dateTimeStr() const
+    constexpr StaticString<DATE_TIME_SIZE> dateTimeStr() const
     {
-        std::stringstream ss;
+        StaticString<DATE_TIME_SIZE> str;
+        str.commit(static_cast<size_t>(formatDateTime(str.data()) - str.data()));
+        return str;
+    }
 
-        ss << dateStr();
-        ss << ' ';
-        ss << timeStr();
+private:
+    // zero padded, values with more digits keep only the lower ones
+    static constexpr char* digits(char* out, unsigned value, const size_t count) noexcept
+    {
+        for (size_t i = count; i > 0; --i) {
+            out[i - 1] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        return out + count;
+    }
 
-        return ss.str();
+    static constexpr unsigned parse(std::string_view str, const size_t pos, const size_t count)
+    {
+        unsigned value = 0;
+        for (const char c : str.substr(pos, count)) {
+            if (c < '0' || c > '9') throw std::invalid_argument("timestamp contains non-digit");
+            value = value * 10 + static_cast<unsigned>(c - '0');
+        }
+        return value;
     }
-};
\ No newline at end of file
+};
@@ -31,7 +31,7 @@ std::expected<void, std::string> ArmNetworkAdapter::getNetworkAdapters(Adapters&
 				static_cast<uint8_t>(itf->nx_interface_physical_address_lsw & 0xF)
 			};
 
-			adapters.emplace_back(std::string(itf->nx_interface_name), "", mac);
+			adapters.emplace_back(itf->nx_interface_name, "", mac);
 		}
 	}
 
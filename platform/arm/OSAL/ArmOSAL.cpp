@@ -29,8 +29,29 @@ ArmMutex::~ArmMutex()
     tx_mutex_delete(&m_mutex);
 }
 void ArmMutex::lock() { while(tx_mutex_get(&m_mutex, TX_WAIT_FOREVER) != TX_SUCCESS); }
+bool ArmMutex::try_lock() { return tx_mutex_get(&m_mutex, TX_NO_WAIT) == TX_SUCCESS; }
 void ArmMutex::unlock() { tx_mutex_put(&m_mutex); }
 
+// --- Semaphore ---
+ArmSemaphore::ArmSemaphore()
+{
+    static std::atomic_size_t id = 0;
+    m_id = id++;
+
+    CHAR name[32];
+    snprintf(name, sizeof(name), "Semaphore %zu", m_id);
+    UINT status = tx_semaphore_create(&m_semaphore, name, 0);
+
+    EATK_ASSERT(status == TX_SUCCESS, "failed to create Semaphore");
+}
+ArmSemaphore::~ArmSemaphore()
+{
+    tx_semaphore_delete(&m_semaphore);
+}
+void ArmSemaphore::acquire() { while(tx_semaphore_get(&m_semaphore, TX_WAIT_FOREVER) != TX_SUCCESS); }
+bool ArmSemaphore::tryAcquire() { return tx_semaphore_get(&m_semaphore, TX_NO_WAIT) == TX_SUCCESS; }
+void ArmSemaphore::release() { tx_semaphore_put(&m_semaphore); }
+
 // --- Thread ---
 ArmThread::~ArmThread()
 {
@@ -150,17 +171,24 @@ VOID ArmCyclicThread::cyclicTaskWrapper(ULONG context)
         return;
     }
 
+    // the statistics run on the tick counter, their resolution is one tick
+    constexpr uint64_t tick_ns = tick_us * 1000ULL;
     ULONG nextCycleTicks = tx_time_get();
     while (self->m_running) {
-        nextCycleTicks += ticks;
-
+        const ULONG startTicks = tx_time_get();
         self->m_cyclicTask();
+        const ULONG endTicks = tx_time_get();
+
+        // relative to the due tick, so the wrap of the 32 bit tick counter cancels out
+        const uint64_t next_ns = self->completeCycle(0, static_cast<ULONG>(startTicks - nextCycleTicks) * tick_ns,
+            static_cast<ULONG>(endTicks - nextCycleTicks) * tick_ns, ticks * tick_ns);
+        nextCycleTicks += static_cast<ULONG>(next_ns / tick_ns);
         if (!self->m_running) break;
 
         ULONG currentTicks = tx_time_get();
         ULONG delayTicks;
 
-        if (nextCycleTicks <= currentTicks) {
+        if (static_cast<LONG>(nextCycleTicks - currentTicks) <= 0) {
             delayTicks = TX_NO_WAIT; // 0
         } else {
             delayTicks = nextCycleTicks - currentTicks;
@@ -319,6 +347,8 @@ void ArmOSAL::printImpl(const char* msg) const { printf("%s", msg); }
 void ArmOSAL::printlnImpl(const char* msg) const { printf("%s\r\n", msg); }
 void ArmOSAL::eprintImpl(const char* emsg) const { printf("%s", emsg); }
 void ArmOSAL::eprintlnImpl(const char* emsg) const { printf("%s\r\n", emsg); }
+void ArmOSAL::printvImpl(std::span<const std::string_view> parts) const { for (const auto& part : parts) printf("%.*s", static_cast<int>(part.size()), part.data()); }
+void ArmOSAL::eprintvImpl(std::span<const std::string_view> parts) const { printvImpl(parts); }
 void ArmOSAL::setConsoleColorImpl(ConsoleColor col) const
 {
     switch(col)
@@ -393,6 +423,8 @@ void ArmOSAL::createTimerImpl(IPolymorphic<OSAL::Timer>& timer) const { timer.co
 
 void ArmOSAL::createMutexImpl(IPolymorphic<OSAL::Mutex>& mutex) const { mutex.construct<ArmMutex>(); }
 
+void ArmOSAL::createSemaphoreImpl(IPolymorphic<OSAL::Semaphore>& semaphore) const { semaphore.construct<ArmSemaphore>(); }
+
 void ArmOSAL::createThreadImpl(IPolymorphic<OSAL::Thread>& thread) const { thread.construct<ArmThread>(); }
 
 void ArmOSAL::createCyclicThreadImpl(IPolymorphic<OSAL::CyclicThread>& cyclicThread) const { cyclicThread.construct<ArmCyclicThread>(); }
@@ -402,4 +434,14 @@ void ArmOSAL::createMessageQueueImpl(IPolymorphic<OSAL::MessageQueue>& queue, IO
     queue.construct<ArmMessageQueue>(store, pool); 
 }
 
+void ArmOSAL::createLockFreeMessageQueueImpl(IPolymorphic<OSAL::MessageQueue>& queue, IObjectStore<OSAL::MessageQueue::SlotType>& store, QueueProducers producers) const 
+{ 
+    if (producers == QueueProducers::Single) {
+        queue.construct<ArmLockFreeMessageQueue<QueueProducers::Single>>(store); 
+    }
+    else {
+        queue.construct<ArmLockFreeMessageQueue<QueueProducers::Multi>>(store); 
+    }
+}
+
 #endif
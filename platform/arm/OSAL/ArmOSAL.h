@@ -2,6 +2,8 @@
 
 #include "EmbedATK/OSAL/OSAL.h"
 
+#include "../../common/OSAL/LockFreeMessageQueue.h"
+
 #include "tx_api.h"
 
 class ArmMutex : public OSAL::Mutex
@@ -11,6 +13,7 @@ public:
     ~ArmMutex();
 private:
     void lock() override;
+    bool try_lock() override;
     void unlock() override;
 
     size_t m_id;
@@ -19,6 +22,22 @@ private:
     friend class ArmOSAL;
 };
 
+class ArmSemaphore : public OSAL::Semaphore
+{
+public:
+    ArmSemaphore();
+    ~ArmSemaphore();
+private:
+    void acquire() override;
+    bool tryAcquire() override;
+    void release() override;
+
+    size_t m_id;
+    TX_SEMAPHORE m_semaphore;
+
+    friend class ArmOSAL;
+};
+
 class ArmThread : public OSAL::Thread
 {
 public:
@@ -80,6 +99,9 @@ private:
     friend class ArmOSAL;
 };
 
+template<QueueProducers Producers>
+using ArmLockFreeMessageQueue = LockFreeMessageQueue<Producers, ArmSemaphore>;
+
 class ArmOSAL : public OSAL
 {
 private:
@@ -92,6 +114,8 @@ private:
     void printlnImpl(const char* msg) const override;
     void eprintImpl(const char* emsg) const override;
     void eprintlnImpl(const char* emsg) const override;
+    void printvImpl(std::span<const std::string_view> parts) const override;
+    void eprintvImpl(std::span<const std::string_view> parts) const override;
     void setConsoleColorImpl(ConsoleColor col) const override;
 
     // --- Time ---
@@ -106,6 +130,9 @@ private:
     // --- Mutex ---
     void createMutexImpl(IPolymorphic<Mutex>& mutex) const override;
 
+    // --- Semaphore ---
+    void createSemaphoreImpl(IPolymorphic<Semaphore>& semaphore) const override;
+
     // --- Thread ---
     void createThreadImpl(IPolymorphic<Thread>& thread) const override;
 
@@ -114,13 +141,19 @@ private:
 
     // --- Message Queue ---
     void createMessageQueueImpl(IPolymorphic<MessageQueue>& queue, IObjectStore<MessageQueue::MsgType*>& store, IPool& pool) const override;
+    void createLockFreeMessageQueueImpl(IPolymorphic<MessageQueue>& queue, IObjectStore<MessageQueue::SlotType>& store, QueueProducers producers) const override;
 };
 
 struct OSAL::StaticImpl
 {
     using Timer         = StaticPolymorphic<OSAL::Timer, OSAL::Timer>;
     using Mutex         = StaticPolymorphic<OSAL::Mutex, ArmMutex>;
+    using Semaphore     = StaticPolymorphic<OSAL::Semaphore, ArmSemaphore>;
     using Thread        = StaticPolymorphic<OSAL::Thread, ArmThread>;
     using CyclicThread  = StaticPolymorphic<OSAL::CyclicThread, ArmCyclicThread>;
-    using MessageQueue  = StaticPolymorphic<OSAL::MessageQueue, ArmMessageQueue>;
+    using MessageQueue  = StaticPolymorphic<OSAL::MessageQueue, std::tuple<
+        ArmMessageQueue, 
+        ArmLockFreeMessageQueue<QueueProducers::Single>, 
+        ArmLockFreeMessageQueue<QueueProducers::Multi>
+    >>;
 };
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "EmbedATK/OSAL/OSAL.h"
+#include "EmbedATK/OSAL/ConsumerWaiter.h"
+
+// Message queue on top of the lock-free ring, shared by all platforms.
+// Producers only touch the ring and, if the consumer is parked, post the semaphore once.
+// The consumer spins through the ring without any system call as long as messages are
+// available and only sleeps on the platform semaphore when the ring ran empty.
+template<QueueProducers Producers, std::derived_from<OSAL::Semaphore> Semaphore>
+class LockFreeMessageQueue : public OSAL::MessageQueue
+{
+public:
+    LockFreeMessageQueue(IObjectStore<SlotType>& store)
+        : m_queue(store) {}
+
+private:
+    bool empty() const override { return m_queue.empty(); }
+
+    bool push(MsgType&& msg) override
+    {
+        if (!m_queue.push(std::move(msg)))
+            return false;
+        notify();
+        return true;
+    }
+
+    bool push(const MsgType& msg) override
+    {
+        if (!m_queue.push(msg))
+            return false;
+        notify();
+        return true;
+    }
+
+    bool pushMany(IQueue<MsgType>&& data) override
+    {
+        if (!m_queue.pushMany(std::move(data)))
+            return false;
+        notify();
+        data.clear();
+        return true;
+    }
+
+    std::optional<MsgType> pop() override
+    {
+        while (true) {
+            if (auto msg = m_queue.pop())
+                return msg;
+            wait();
+        }
+    }
+
+    bool popAvail(IQueue<MsgType>& data) override
+    {
+        // nothing could ever be taken, waiting would spin on the non-empty ring
+        if (data.full())
+            return false;
+
+        while (!tryPopAvail(data)) {
+            wait();
+        }
+        return true;
+    }
+
+    std::optional<MsgType> tryPop() override { return m_queue.pop(); }
+
+    bool tryPopAvail(IQueue<MsgType>& data) override
+    {
+        const size_t space = data.capacity() - data.size();
+        return m_queue.consume([&data](MsgType&& msg) { data.push(std::move(msg)); }, space) > 0;
+    }
+
+    void notify() { m_waiter.notify(); }
+    void wait() { m_waiter.wait([this]() { return m_queue.empty(); }); }
+
+    LockFreeQueueView<MsgType, Producers> m_queue;
+
+    ConsumerWaiter<Semaphore> m_waiter;
+};
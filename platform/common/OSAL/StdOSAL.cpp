@@ -13,8 +13,14 @@ bool StdTimer::isExpired() const { return std::chrono::steady_clock::now() >= m_
 
 // --- Mutex ---
 void StdMutex::lock() { m_mutex.lock(); }
+bool StdMutex::try_lock() { return m_mutex.try_lock(); }
 void StdMutex::unlock() { m_mutex.unlock(); }
 
+// --- Semaphore ---
+void StdSemaphore::acquire() { m_semaphore.acquire(); }
+bool StdSemaphore::tryAcquire() { return m_semaphore.try_acquire(); }
+void StdSemaphore::release() { m_semaphore.release(); }
+
 // --- Thread ---
 bool StdThread::start()
 {
@@ -38,14 +44,21 @@ bool StdCyclicThread::start(uint64_t cycleTime_us)
         m_running = true;
         promise.set_value();
 
-        auto nextCycle = std::chrono::steady_clock::now();
-        while (m_running) {
-            nextCycle += std::chrono::microseconds(cycleTime_us);
+        const auto now_ns = []() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        };
 
+        const uint64_t period_ns = cycleTime_us * 1000ULL;
+        uint64_t due_ns = now_ns();
+        while (m_running) {
             lock.unlock();
+            const uint64_t start_ns = now_ns();
             m_cyclicTask();
+            due_ns = completeCycle(due_ns, start_ns, now_ns(), period_ns);
             lock.lock();
 
+            const std::chrono::steady_clock::time_point nextCycle{ std::chrono::nanoseconds(due_ns) };
             m_condition.wait_until(lock, nextCycle, [this]() { return !m_running; });
         }
     });
@@ -121,15 +134,14 @@ bool StdMessageQueue::pushMany(IQueue<MsgType>&& data)
                 return false;
 
             static constexpr auto alloc = allocData<MsgType>();
-            for (auto& msg : data) {
+            data.consume([this](MsgType&& msg) {
                 auto* ptr = static_cast<MsgType*>(m_pool.allocate(alloc.size, alloc.align));
                 std::construct_at(ptr, std::move(msg));
                 m_queue.push(ptr); 
-            }
+            });
         }
 
         m_condition.notify_all();
-        data.clear();
         return true;
     }
     else {
@@ -164,22 +176,7 @@ bool StdMessageQueue::popAvail(IQueue<MsgType>& data)
             return false;
     }
 
-    static constexpr auto alloc = allocData<MsgType>();
-    if (m_queue.size() > data.capacity()) {
-        for (size_t i = 0; i < data.capacity(); ++i) {
-            auto* ptr = m_queue[i];
-            data.push(std::move(*ptr));
-            m_pool.deallocate(ptr, alloc.size, alloc.align);
-        }
-        m_queue.erase(0, data.capacity());
-    }
-    else {
-        for (auto* ptr : m_queue) {
-            data.push(std::move(*ptr));
-            m_pool.deallocate(ptr, alloc.size, alloc.align);
-        }
-        m_queue.clear();
-    }
+    moveAvail(data);
     return true;
 }
 std::optional<OSAL::MessageQueue::MsgType> StdMessageQueue::tryPop()
@@ -200,25 +197,20 @@ bool StdMessageQueue::tryPopAvail(IQueue<MsgType>& data)
     if (m_queue.empty())
         return false;
 
-    static constexpr auto alloc = allocData<MsgType>();
-    if (m_queue.size() > data.capacity()) {
-        for (size_t i = 0; i < data.capacity(); ++i) {
-            auto* ptr = m_queue[i];
-            data.push(std::move(*ptr));
-            m_pool.deallocate(ptr, alloc.size, alloc.align);
-        }
-        m_queue.erase(0, data.capacity());
-    }
-    else {
-        for (auto* ptr : m_queue) {
-            data.push(std::move(*ptr));
-            m_pool.deallocate(ptr, alloc.size, alloc.align);
-        }
-        m_queue.clear();
-    }
+    moveAvail(data);
     return true;
 }
 
+void StdMessageQueue::moveAvail(IQueue<MsgType>& data)
+{
+    static constexpr auto alloc = allocData<MsgType>();
+
+    // walks the ring in its contiguous runs and releases the consumed slots in one go
+    m_queue.consume([this, &data](MsgType*&& ptr) {
+        data.push(std::move(*ptr));
+        m_pool.deallocate(ptr, alloc.size, alloc.align);
+    }, data.capacity());
+}
 
 // --- StdOSAL ---
 uint16_t StdOSAL::hostToNetworkImpl(uint16_t h) const 
@@ -242,6 +234,8 @@ void StdOSAL::printImpl(const char* msg) const { std::cout << msg; }
 void StdOSAL::printlnImpl(const char* msg) const { std::cout << msg << '\n'; }
 void StdOSAL::eprintImpl(const char* emsg) const { std::cerr << emsg; }
 void StdOSAL::eprintlnImpl(const char* emsg) const { std::cerr << emsg << '\n'; }
+void StdOSAL::printvImpl(std::span<const std::string_view> parts) const { for (const auto& part : parts) std::cout << part; }
+void StdOSAL::eprintvImpl(std::span<const std::string_view> parts) const { for (const auto& part : parts) std::cerr << part; }
 void StdOSAL::setConsoleColorImpl(ConsoleColor col) const { EATK_UNUSED(col); }
 
 uint64_t StdOSAL::monotonicTimeImpl() const 
@@ -288,8 +282,19 @@ void StdOSAL::createTimerImpl(IPolymorphic<OSAL::Timer>& timer) const { timer.co
 
 void StdOSAL::createMutexImpl(IPolymorphic<OSAL::Mutex>& mutex) const { mutex.construct<StdMutex>(); }
 
+void StdOSAL::createSemaphoreImpl(IPolymorphic<OSAL::Semaphore>& semaphore) const { semaphore.construct<StdSemaphore>(); }
+
 void StdOSAL::createMessageQueueImpl(IPolymorphic<OSAL::MessageQueue>& queue, IObjectStore<OSAL::MessageQueue::MsgType*>& store, IPool& pool) const 
 { 
     queue.construct<StdMessageQueue>(store, pool); 
 }
 
+void StdOSAL::createLockFreeMessageQueueImpl(IPolymorphic<OSAL::MessageQueue>& queue, IObjectStore<OSAL::MessageQueue::SlotType>& store, QueueProducers producers) const 
+{ 
+    if (producers == QueueProducers::Single) {
+        queue.construct<StdLockFreeMessageQueue<QueueProducers::Single>>(store); 
+    }
+    else {
+        queue.construct<StdLockFreeMessageQueue<QueueProducers::Multi>>(store); 
+    }
+}
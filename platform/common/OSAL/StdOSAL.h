@@ -2,9 +2,12 @@
 
 #include "EmbedATK/OSAL/OSAL.h"
 
+#include "LockFreeMessageQueue.h"
+
 #include <mutex>
 #include <thread>
 #include <condition_variable>
+#include <semaphore>
 
 class StdTimer : public OSAL::Timer
 {
@@ -21,6 +24,7 @@ class StdMutex : public OSAL::Mutex
 {
 private:
     void lock() override;
+    bool try_lock() override;
     void unlock() override;
     
     std::mutex m_mutex;
@@ -28,6 +32,18 @@ private:
     friend class StdOSAL;
 };
 
+class StdSemaphore : public OSAL::Semaphore
+{
+private:
+    void acquire() override;
+    bool tryAcquire() override;
+    void release() override;
+
+    std::counting_semaphore<> m_semaphore {0};
+
+    friend class StdOSAL;
+};
+
 class StdThread : public OSAL::Thread
 {
 private:
@@ -65,6 +81,8 @@ private:
     bool popAvail(IQueue<MsgType>& data) override;
     std::optional<MsgType> tryPop() override;
     bool tryPopAvail(IQueue<MsgType>& data) override;
+
+    void moveAvail(IQueue<MsgType>& data);
     
     mutable std::mutex m_mutex;
     std::condition_variable m_condition;
@@ -76,6 +94,9 @@ private:
     friend class StdOSAL;
 };
 
+template<QueueProducers Producers>
+using StdLockFreeMessageQueue = LockFreeMessageQueue<Producers, StdSemaphore>;
+
 class StdOSAL : public OSAL
 {
 protected:
@@ -88,6 +109,8 @@ protected:
     void printlnImpl(const char* msg) const override;
     void eprintImpl(const char* emsg) const override;
     void eprintlnImpl(const char* emsg) const override;
+    void printvImpl(std::span<const std::string_view> parts) const override;
+    void eprintvImpl(std::span<const std::string_view> parts) const override;
     void setConsoleColorImpl(ConsoleColor col) const override;
 
     // --- Time ---
@@ -102,6 +125,10 @@ protected:
     // --- Mutex ---
     void createMutexImpl(IPolymorphic<Mutex>& mutex) const override;
 
+    // --- Semaphore ---
+    void createSemaphoreImpl(IPolymorphic<Semaphore>& semaphore) const override;
+
     // --- Message Queue ---
     void createMessageQueueImpl(IPolymorphic<MessageQueue>& queue, IObjectStore<MessageQueue::MsgType*>& store, IPool& pool) const override;
+    void createLockFreeMessageQueueImpl(IPolymorphic<MessageQueue>& queue, IObjectStore<MessageQueue::SlotType>& store, QueueProducers producers) const override;
 };
\ No newline at end of file
@@ -53,7 +53,7 @@ std::expected<void, std::string> LinuxNetworkAdapter::getNetworkAdapters(Adapter
 				memcpy(mac.data(), mac_ptr, 6);
 			}
 
-			adapters.emplace_back(std::string(ids[i].if_name), "", mac);
+			adapters.emplace_back(ids[i].if_name, "", mac);
 		}
 	}
 
@@ -4,19 +4,85 @@
 #include "LinuxOSAL.h"
 
 #include <arpa/inet.h>
+#include <sys/uio.h>
+#include <unistd.h>
 #include <time.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <alloca.h>
 #include <cerrno>
 
+// --- Real-time profile ---
+// stack that prefaulting leaves untouched: glibc keeps the thread control block and the TLS
+// at the top of a user provided stack, the thread entry and the task need the frames above
+constexpr size_t PREFAULT_STACK_MARGIN = 8 * 1024;
+
+static bool initAttributes(pthread_attr_t& attr, std::span<std::byte> stack, const ThreadProfile& profile, int prio)
+{
+    if (!stack.empty()) {
+        if (pthread_attr_setstack(&attr, stack.data(), stack.size()) != 0)
+            return false;
+    }
+
+    // a profile that prefaults more than the stack holds would overflow it right away
+    if (profile.prefaultStack > 0) {
+        size_t stackSize = 0;
+        if (pthread_attr_getstacksize(&attr, &stackSize) != 0 || stackSize < PREFAULT_STACK_MARGIN ||
+            profile.prefaultStack > stackSize - PREFAULT_STACK_MARGIN)
+            return false;
+    }
+
+    // set before creation, so the thread never runs with the inherited policy
+    if (profile.policy != SchedPolicy::Default) {
+        sched_param param{};
+        param.sched_priority = prio;
+        const int policy = profile.policy == SchedPolicy::Fifo ? SCHED_FIFO : SCHED_RR;
+        if (pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED) != 0 ||
+            pthread_attr_setschedpolicy(&attr, policy) != 0 ||
+            pthread_attr_setschedparam(&attr, &param) != 0)
+            return false;
+    }
+
+    if (profile.cpuMask != 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (size_t cpu = 0; cpu < 64; ++cpu) {
+            if (profile.cpuMask & (1ULL << cpu))
+                CPU_SET(cpu, &cpus);
+        }
+        if (pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus) != 0)
+            return false;
+    }
+
+    // process wide, also keeps the pages of the new thread's stack resident
+    if (profile.lockMemory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        return false;
+
+    return true;
+}
+
+// touches one byte per page below the current frame, the size was checked against the stack on start
+[[gnu::noinline]] static void prefaultStack(size_t bytes)
+{
+    if (bytes == 0)
+        return;
+
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto* stack = static_cast<volatile uint8_t*>(alloca(bytes));
+    for (size_t i = 0; i < bytes; i += page) {
+        stack[i] = 0;
+    }
+}
+
 // --- Thread ---
 bool LinuxThread::start()
 {
     pthread_attr_t attr;
     pthread_attr_init(&attr);
 
-    if (!m_stack.empty()) {
-        int res = pthread_attr_setstack(&attr, m_stack.data(), m_stack.size());
-        if (res != 0)
-            return false;
+    if (!initAttributes(attr, m_stack, m_profile, m_prio)) {
+        pthread_attr_destroy(&attr);
+        return false;
     }
 
     int status = pthread_create(&m_thread, &attr, &LinuxThread::taskWrapper, this);
@@ -48,6 +114,7 @@ void* LinuxThread::taskWrapper(void* context)
 {
     auto self = static_cast<LinuxThread*>(context);
     if (self && self->m_task) {
+        prefaultStack(self->m_profile.prefaultStack);
         self->m_task();
     }
     return nullptr;
@@ -61,19 +128,20 @@ bool LinuxCyclicThread::start(uint64_t cycleTime_us)
     pthread_attr_t attr;
     pthread_attr_init(&attr);
 
-    if (!m_stack.empty()) {
-        if (pthread_attr_setstack(&attr, m_stack.data(), m_stack.size()) != 0)
-            return false;
+    if (!initAttributes(attr, m_stack, m_profile, m_prio)) {
+        pthread_attr_destroy(&attr);
+        return false;
     }
 
     sem_init(&m_started, 0, 0);
-    sem_init(&m_shutdown, 0, 0);
 
     int status = pthread_create(&m_thread, &attr, &LinuxCyclicThread::cyclicTaskWrapper, this);
     pthread_attr_destroy(&attr);
 
-    if (status != 0)
+    if (status != 0) {
+        sem_destroy(&m_started);
         return false;
+    }
 
     if (pthread_setname_np(m_thread, m_name) != 0)
         return false;
@@ -82,10 +150,10 @@ bool LinuxCyclicThread::start(uint64_t cycleTime_us)
     return true;
 }
 
+// the thread sees the flag at the end of its current cycle, at the latest one period later
 void LinuxCyclicThread::shutdown()
 {
     m_running = false;
-    sem_post(&m_shutdown);
 
     if (m_thread) {
         if (pthread_join(m_thread, nullptr) != 0)
@@ -94,7 +162,6 @@ void LinuxCyclicThread::shutdown()
     }
 
     sem_destroy(&m_started);
-    sem_destroy(&m_shutdown);
 }
 
 bool LinuxCyclicThread::setPriority(int prio, int policy)
@@ -112,29 +179,83 @@ void* LinuxCyclicThread::cyclicTaskWrapper(void* context)
     if (!self || !self->m_cyclicTask)
         return nullptr;
 
+    prefaultStack(self->m_profile.prefaultStack);
+
     self->m_running = true;
     sem_post(&self->m_started);
 
-    timespec nextCycle{};
-    clock_gettime(CLOCK_MONOTONIC, &nextCycle);
-    
-    while (self->m_running) {
-        uint64_t next_ns = (static_cast<uint64_t>(nextCycle.tv_sec) * 1000000000ULL
-                      + static_cast<uint64_t>(nextCycle.tv_nsec))
-                      + (self->m_cycleTime_us * 1000ULL);
+    const auto now_ns = []() {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+    };
 
-        nextCycle.tv_sec = next_ns / 1000000000ULL;
-        nextCycle.tv_nsec = next_ns % 1000000000ULL;
+    const uint64_t period_ns = self->m_cycleTime_us * 1000ULL;
+    uint64_t due_ns = now_ns();
 
+    while (self->m_running) {
+        const uint64_t start_ns = now_ns();
         self->m_cyclicTask();
+        due_ns = self->completeCycle(due_ns, start_ns, now_ns(), period_ns);
         if (!self->m_running) break;
 
-        while (sem_clockwait(&self->m_shutdown, CLOCK_MONOTONIC, &nextCycle) != 0 && errno == EINTR);
+        // absolute wakeups, the time spent in the task does not shift the schedule
+        const timespec nextCycle{
+            .tv_sec = static_cast<time_t>(due_ns / 1000000000ULL),
+            .tv_nsec = static_cast<long>(due_ns % 1000000000ULL)
+        };
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &nextCycle, nullptr) == EINTR);
     }
     return nullptr;
 }
 
 // --- LinuxOSAL ---
+void LinuxOSAL::writeParts(int fd, std::span<const std::string_view> parts)
+{
+    constexpr size_t MAX_PARTS = 64;
+    std::array<iovec, MAX_PARTS> iov;
+
+    while (!parts.empty()) {
+        const size_t count = std::min(parts.size(), MAX_PARTS);
+        for (size_t i = 0; i < count; ++i) {
+            iov[i].iov_base = const_cast<char*>(parts[i].data());
+            iov[i].iov_len = parts[i].size();
+        }
+
+        // retry the remainder of a partial write
+        size_t first = 0;
+        while (first < count) {
+            const ssize_t written = writev(fd, iov.data() + first, static_cast<int>(count - first));
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+
+            size_t remaining = static_cast<size_t>(written);
+            while (first < count && remaining >= iov[first].iov_len) {
+                remaining -= iov[first++].iov_len;
+            }
+            if (first < count) {
+                iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + remaining;
+                iov[first].iov_len -= remaining;
+            }
+        }
+        parts = parts.subspan(count);
+    }
+}
+
+void LinuxOSAL::printvImpl(std::span<const std::string_view> parts) const
+{
+    std::cout.flush();
+    writeParts(STDOUT_FILENO, parts);
+}
+
+void LinuxOSAL::eprintvImpl(std::span<const std::string_view> parts) const
+{
+    std::cerr.flush();
+    writeParts(STDERR_FILENO, parts);
+}
+
 void LinuxOSAL::setConsoleColorImpl(ConsoleColor col) const
 {
     switch(col)
@@ -30,7 +30,6 @@ private:
 
     std::atomic_bool m_running;
     sem_t m_started;
-    sem_t m_shutdown;
     uint64_t m_cycleTime_us;
 
     pthread_t m_thread;
@@ -42,8 +41,12 @@ class LinuxOSAL : public StdOSAL
 {
 private:
     // --- Printing ---
+    void printvImpl(std::span<const std::string_view> parts) const override;
+    void eprintvImpl(std::span<const std::string_view> parts) const override;
     void setConsoleColorImpl(ConsoleColor col) const override;
 
+    static void writeParts(int fd, std::span<const std::string_view> parts);
+
     // --- Thread ---
     void createThreadImpl(IPolymorphic<OSAL::Thread>& thread) const override;
 
@@ -56,7 +59,12 @@ struct OSAL::StaticImpl
 {
     using Timer         = StaticPolymorphic<OSAL::Timer, StdTimer>;
     using Mutex         = StaticPolymorphic<OSAL::Mutex, StdMutex>;
+    using Semaphore     = StaticPolymorphic<OSAL::Semaphore, StdSemaphore>;
     using Thread        = StaticPolymorphic<OSAL::Thread, LinuxThread>;
     using CyclicThread  = StaticPolymorphic<OSAL::CyclicThread, LinuxCyclicThread>;
-    using MessageQueue  = StaticPolymorphic<OSAL::MessageQueue, StdMessageQueue>;
+    using MessageQueue  = StaticPolymorphic<OSAL::MessageQueue, std::tuple<
+        StdMessageQueue, 
+        StdLockFreeMessageQueue<QueueProducers::Single>, 
+        StdLockFreeMessageQueue<QueueProducers::Multi>
+    >>;
 };
\ No newline at end of file
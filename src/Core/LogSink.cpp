@@ -0,0 +1,113 @@
+#include "pch.h"
+
+#include "EmbedATK/Core/LogSink.h"
+
+#if !defined(EATK_DISABLE_LOGGING) && defined(__cpp_lib_format)
+
+// --- File Log Sink ---
+FileLogSink::FileLogSink(const char* path, const size_t maxSize, const size_t maxFiles)
+    : m_maxSize(maxSize), m_maxFiles(std::max<size_t>(maxFiles, 1))
+{
+    if (std::strlen(path) >= m_path.size())
+        throw std::length_error("log file path too long");
+
+    std::strncpy(m_path.data(), path, m_path.size());
+    open();
+}
+
+FileLogSink::~FileLogSink()
+{
+    if (m_file)
+        std::fclose(m_file);
+}
+
+void FileLogSink::write(const LogBatch& batch)
+{
+    if (!m_file)
+        return;
+
+    if (m_size > 0 && m_size + batch.text.size() > m_maxSize) {
+        rotate();
+        if (!m_file)
+            return;
+    }
+
+    m_size += std::fwrite(batch.text.data(), 1, batch.text.size(), m_file);
+}
+
+void FileLogSink::open()
+{
+    m_file = std::fopen(m_path.data(), "ab");
+    if (!m_file)
+        return;
+
+    std::setvbuf(m_file, nullptr, _IONBF, 0);
+    std::fseek(m_file, 0, SEEK_END);
+    const long size = std::ftell(m_file);
+    m_size = size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+void FileLogSink::rotate()
+{
+    std::fclose(m_file);
+    m_file = nullptr;
+
+    // path, '.' and the decimal digits of any file index
+    std::array<char, EATK_LOG_PATH_SIZE + 1 + std::numeric_limits<size_t>::digits10 + 1> from, to;
+    for (size_t i = m_maxFiles - 1; i > 0; --i) {
+        std::snprintf(to.data(), to.size(), "%s.%zu", m_path.data(), i);
+        if (i > 1)
+            std::snprintf(from.data(), from.size(), "%s.%zu", m_path.data(), i - 1);
+        else
+            std::snprintf(from.data(), from.size(), "%s", m_path.data());
+
+        std::remove(to.data());
+        std::rename(from.data(), to.data());
+    }
+    if (m_maxFiles == 1)
+        std::remove(m_path.data());
+
+    open();
+}
+
+// --- Frame Log Sink ---
+FrameLogSink::FrameLogSink(const INetworkAdapter& adapter, const uint16_t etherType, const MAC& destination)
+    : m_adapter(adapter)
+{
+    const MAC& source = adapter.getInfo().mac;
+    const uint16_t type = OSAL::hostToNetwork(etherType);
+
+    std::ranges::copy(destination, m_frame.begin());
+    std::ranges::copy(source, m_frame.begin() + destination.size());
+    std::memcpy(m_frame.data() + 2*destination.size(), &type, sizeof(type));
+}
+
+void FrameLogSink::write(const LogBatch& batch)
+{
+    // sending through a closed adapter asserts, which would log again
+    if (!m_adapter.isSocketOpen())
+        return;
+
+    std::string_view text = batch.text;
+    while (!text.empty()) {
+        size_t size = std::min(text.size(), MAX_PAYLOAD);
+        if (size < text.size()) {
+            const size_t lineEnd = text.substr(0, size).rfind('\n');
+            if (lineEnd != std::string_view::npos)
+                size = lineEnd + 1;
+        }
+        send(text.substr(0, size));
+        text.remove_prefix(size);
+    }
+}
+
+void FrameLogSink::send(std::string_view payload)
+{
+    std::memcpy(m_frame.data() + HEADER_SIZE, payload.data(), payload.size());
+    if (m_adapter.sendFrame(m_frame.data(), HEADER_SIZE + payload.size()))
+        ++m_framesSent;
+    else
+        ++m_framesFailed;
+}
+
+#endif
@@ -17,13 +17,19 @@ constexpr size_t LOGGER_STACK_SIZE = 8*1024;
 constexpr size_t LOGGER_STACK_SIZE = 16384;
 #endif
 
-using ConcreteLogger = Logger<LOGGER_MSG_QUEUE_SIZE, LOGGER_STACK_SIZE>;
+#if defined(EATK_PLATFORM_ARM)
+constexpr size_t LOGGER_BATCH_SIZE = 8;
+#else
+constexpr size_t LOGGER_BATCH_SIZE = 32;
+#endif
+
+using ConcreteLogger = Logger<LOGGER_MSG_QUEUE_SIZE, LOGGER_STACK_SIZE, LOGGER_BATCH_SIZE>;
 static StaticPolymorphic<ILogger, ConcreteLogger> s_logger;
 ILogger* g_logger = nullptr;
 
 void ILogger::init(int prio)
 {
-    s_logger.construct<Logger<LOGGER_MSG_QUEUE_SIZE, LOGGER_STACK_SIZE>>(prio);
+    s_logger.construct<ConcreteLogger>(prio);
     g_logger = s_logger.get();
     s_logger.as<ConcreteLogger>()->start();
 }
@@ -34,4 +40,104 @@ void ILogger::shutdown()
     g_logger = nullptr;
 }
 
+bool ILogger::addSink(ILogSink& sink)
+{
+    std::lock_guard lock(*m_sinkMutex.get());
+    if (m_sinks.full() || std::ranges::find(m_sinks, &sink) != m_sinks.end())
+        return false;
+
+    m_sinks.push_back(&sink);
+    return true;
+}
+
+void ILogger::removeSink(ILogSink& sink)
+{
+    std::lock_guard lock(*m_sinkMutex.get());
+    const auto it = std::ranges::find(m_sinks, &sink);
+    if (it != m_sinks.end())
+        m_sinks.erase(it);
+}
+
+void ILogger::printMessage(const LogSite& site, const Timestamp& timestamp, std::string_view message)
+{
+    // one character is kept free for the line break
+    StaticString<EATK_LOG_LINE_SIZE + 1> text;
+    formatPrefix(text, site, timestamp);
+    if (text.full())
+        text.pop_back();
+    const size_t prefix = text.size();
+    text.append(message.substr(0, text.available() - 1));
+    text.push_back('\n');
+
+    const std::string_view line = std::string_view{text}.substr(0, text.size() - 1);
+    const LogRecord record{ &site, timestamp, line, line.substr(prefix) };
+    writeSinks(LogBatch{ text, {&record, 1} });
+}
+
+void ILogger::writeSinks(const LogBatch& batch)
+{
+    std::lock_guard lock(*m_sinkMutex.get());
+    for (auto* sink : m_sinks.fast()) {
+        sink->write(batch);
+    }
+}
+
+void ILogger::setLevel(const LogLevel level)
+{
+    std::lock_guard lock(*m_levelMutex.get());
+    m_defaultLevel = level;
+    m_levelGeneration.fetch_add(1, std::memory_order_release);
+}
+
+bool ILogger::setLevel(std::string_view module, const LogLevel level)
+{
+    if (module.empty() || module.size() > EATK_LOG_MODULE_NAME_SIZE)
+        return false;
+
+    std::lock_guard lock(*m_levelMutex.get());
+    ModuleLevel* entry = nullptr;
+    for (auto& m : m_modules) {
+        const std::string_view name{m.name.data(), m.length};
+        if (name == module) {
+            entry = &m;
+            break;
+        }
+        if (!entry && m.length == 0)
+            entry = &m;
+    }
+    if (!entry)
+        return false;
+
+    std::ranges::copy(module, entry->name.begin());
+    entry->length = module.size();
+    entry->level = level;
+    m_levelGeneration.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+void ILogger::resetLevel(std::string_view module)
+{
+    std::lock_guard lock(*m_levelMutex.get());
+    for (auto& m : m_modules) {
+        if (std::string_view{m.name.data(), m.length} == module)
+            m.length = 0;
+    }
+    m_levelGeneration.fetch_add(1, std::memory_order_release);
+}
+
+ILogger::LogLevel ILogger::level(std::string_view location) const
+{
+    std::lock_guard lock(*m_levelMutex.get());
+    const ModuleLevel* match = nullptr;
+    for (const auto& m : m_modules) {
+        if (m.length == 0 || (match && match->length >= m.length))
+            continue;
+
+        const std::string_view name{m.name.data(), m.length};
+        if (location == name || (location.starts_with(name) && location.substr(name.size()).starts_with("::")))
+            match = &m;
+    }
+    return match ? match->level : m_defaultLevel;
+}
+
 #endif
@@ -18,6 +18,9 @@
 #include <cstring>
 #include <any>
 #include <expected>
+#include <atomic>
+#include <bit>
+#include <limits>
 
 // Containers
 #include <tuple>
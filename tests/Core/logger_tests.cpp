@@ -0,0 +1,592 @@
+// Trace call sites are compiled out in this test
+#define EATK_LOG_MIN_LEVEL 1
+
+#include "EmbedATK/EmbedATK.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fstream>
+
+int main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
+
+// Keeps the records of a log call instead of queueing them, so they can be inspected.
+class CaptureLogger : public ILogger
+{
+public:
+    const LogData& last() const { return m_last; }
+    size_t count() const { return m_count; }
+
+    std::string message() const
+    {
+        std::string out;
+        formatMessage(out, m_last);
+        return out;
+    }
+
+private:
+    void addMessage(LogData&& data) override
+    {
+        m_last = data;
+        m_count++;
+    }
+
+    LogData m_last{};
+    size_t m_count = 0;
+};
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+struct DeferredPoint
+{
+    int x;
+    int y;
+};
+
+template<>
+struct is_deferrable_log_arg<DeferredPoint> : std::true_type {};
+
+template<>
+struct std::formatter<Point> : std::formatter<int>
+{
+    auto format(const Point& p, std::format_context& ctx) const
+    {
+        return std::format_to(ctx.out(), "({}, {})", p.x, p.y);
+    }
+};
+
+template<>
+struct std::formatter<DeferredPoint> : std::formatter<int>
+{
+    auto format(const DeferredPoint& p, std::format_context& ctx) const
+    {
+        return std::format_to(ctx.out(), "({}, {})", p.x, p.y);
+    }
+};
+
+// --- Locations ---
+
+static_assert(functionToLocation("void foo()") == "foo");
+static_assert(functionToLocation("void Adapter::send(int)") == "Adapter::send");
+static_assert(functionToLocation("bool net::eth::Adapter::send(const uint8_t*, size_t) const") == "Adapter::send");
+static_assert(functionToLocation("Adapter::~Adapter()") == "Adapter::~Adapter");
+static_assert(functionToLocation("void Queue<int, 4>::push(const T&) [with T = int]") == "Queue<int, 4>::push");
+static_assert(functionToLocation("void Queue<std::pair<int, int>, 4>::push(int)") == "Queue<std::pair<int, int>, 4>::push");
+static_assert(functionToLocation("T make<Foo>(int)") == "make<Foo>");
+static_assert(functionToLocation("int main (int, char**)") == "main");
+static_assert(functionToLocation("Adapter::send()::<lambda()>") == "Adapter::send");
+static_assert(functionToLocation("top level") == "top level");
+
+TEST(Logger, SiteLocation)
+{
+    constexpr uint_least32_t line = __LINE__;
+    static constexpr LogSite site EATK_LOG_SITE_LOC(LogLevel::Warn, "Network");
+    EXPECT_EQ(site.level, LogLevel::Warn);
+    EXPECT_EQ(site.location, "Network");
+    EXPECT_TRUE(site.file.ends_with("logger_tests.cpp"));
+    EXPECT_EQ(site.line, line + 1);
+}
+
+// --- Deferred Formatting ---
+
+TEST(Logger, DeferrableArgs)
+{
+    EXPECT_TRUE((ILogger::isDeferrable<int, double, bool, char>()));
+    EXPECT_TRUE((ILogger::isDeferrable<const uint64_t&, LogLevel>()));
+    EXPECT_TRUE((ILogger::isDeferrable<DeferredPoint>()));
+    EXPECT_TRUE((ILogger::isDeferrable<>()));
+
+    // anything that may refer to foreign memory is formatted eagerly
+    EXPECT_FALSE((ILogger::isDeferrable<const char*>()));
+    EXPECT_FALSE((ILogger::isDeferrable<int, std::string_view>()));
+    EXPECT_FALSE((ILogger::isDeferrable<std::string>()));
+    EXPECT_FALSE((ILogger::isDeferrable<std::span<const int>>()));
+    EXPECT_FALSE((ILogger::isDeferrable<Point>()));
+
+    // the raw arguments have to fit into the record
+    EXPECT_FALSE((ILogger::isDeferrable<std::array<uint8_t, EATK_LOG_ARGS_SIZE + 1>>()));
+}
+
+TEST(Logger, DeferredRecord)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    CaptureLogger logger;
+
+    logger.log(site, true, "value {} scaled {} flag {}", 42, 0.5, true);
+    EXPECT_EQ(logger.last().site, &site);
+    EXPECT_EQ(logger.last().size, sizeof(int) + sizeof(double) + sizeof(bool));
+    EXPECT_EQ(logger.message(), "value 42 scaled 0.5 flag true");
+
+    logger.log(site, true, "point {}", DeferredPoint{ 1, 2 });
+    EXPECT_EQ(logger.last().size, sizeof(DeferredPoint));
+    EXPECT_EQ(logger.message(), "point (1, 2)");
+}
+
+TEST(Logger, EagerRecord)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    CaptureLogger logger;
+
+    std::string name = "adapter0";
+    logger.log(site, true, "{} value {} at {}", name, 7, Point{ 3, 4 });
+    EXPECT_EQ(logger.last().size, std::string_view{"adapter0 value 7 at (3, 4)"}.size());
+
+    // the text is rendered on the caller's thread, later changes do not show up
+    name = "changed";
+    EXPECT_EQ(logger.message(), "adapter0 value 7 at (3, 4)");
+}
+
+TEST(Logger, EagerRecordTruncated)
+{
+    static constexpr LogSite site EATK_LOG_SITE(LogLevel::Info);
+    CaptureLogger logger;
+
+    constexpr size_t ARGS_SIZE = EATK_LOG_ARGS_SIZE;
+    const std::string text(ARGS_SIZE + 10, 'x');
+    logger.log(site, true, "{}", text);
+
+    const std::string message = logger.message();
+    EXPECT_EQ(logger.last().size, ARGS_SIZE);
+    EXPECT_EQ(message.size(), ARGS_SIZE);
+    EXPECT_TRUE(message.ends_with(ILogger::TRUNCATION_MARKER));
+    EXPECT_EQ(message.substr(0, message.size() - ILogger::TRUNCATION_MARKER.size()), text.substr(0, ARGS_SIZE - ILogger::TRUNCATION_MARKER.size()));
+
+    // a message that fits exactly is not marked
+    const std::string exact(ARGS_SIZE, 'y');
+    logger.log(site, true, "{}", exact);
+    EXPECT_EQ(logger.message(), exact);
+}
+
+// --- Levels ---
+
+TEST(Logger, ModuleLevels)
+{
+    CaptureLogger logger;
+    EXPECT_EQ(logger.level("Adapter::send"), LogLevel::Trace);
+
+    // longest matching module wins, no matter in which order they were set
+    EXPECT_TRUE(logger.setLevel("Adapter::send", LogLevel::Error));
+    EXPECT_TRUE(logger.setLevel("Adapter", LogLevel::Warn));
+    EXPECT_EQ(logger.level("Adapter"), LogLevel::Warn);
+    EXPECT_EQ(logger.level("Adapter::receive"), LogLevel::Warn);
+    EXPECT_EQ(logger.level("Adapter::send"), LogLevel::Error);
+
+    // a module only matches whole scopes
+    EXPECT_EQ(logger.level("AdapterPool::send"), LogLevel::Trace);
+    EXPECT_EQ(logger.level("Adapt"), LogLevel::Trace);
+    EXPECT_EQ(logger.level("Network::Adapter"), LogLevel::Trace);
+
+    logger.setLevel(LogLevel::Info);
+    EXPECT_EQ(logger.level("Network"), LogLevel::Info);
+    EXPECT_EQ(logger.level("Adapter::send"), LogLevel::Error);
+
+    logger.resetLevel("Adapter::send");
+    EXPECT_EQ(logger.level("Adapter::send"), LogLevel::Warn);
+    logger.resetLevel("Adapter");
+    EXPECT_EQ(logger.level("Adapter::send"), LogLevel::Info);
+}
+
+TEST(Logger, ModuleLevelsLimits)
+{
+    CaptureLogger logger;
+    EXPECT_FALSE(logger.setLevel("", LogLevel::Warn));
+    EXPECT_FALSE(logger.setLevel(std::string(EATK_LOG_MODULE_NAME_SIZE + 1, 'm'), LogLevel::Warn));
+    EXPECT_TRUE(logger.setLevel(std::string(EATK_LOG_MODULE_NAME_SIZE, 'm'), LogLevel::Warn));
+
+    for (size_t i = 1; i < EATK_LOG_MAX_MODULES; ++i) {
+        EXPECT_TRUE(logger.setLevel(std::format("Module{}", i), LogLevel::Warn));
+    }
+    EXPECT_FALSE(logger.setLevel("Full", LogLevel::Warn));
+
+    // updating an existing module and reusing a reset entry still works
+    EXPECT_TRUE(logger.setLevel("Module1", LogLevel::Error));
+    logger.resetLevel("Module2");
+    EXPECT_TRUE(logger.setLevel("Full", LogLevel::Error));
+    EXPECT_EQ(logger.level("Full::method"), LogLevel::Error);
+}
+
+TEST(Logger, SiteLevelCache)
+{
+    static constexpr LogSite site EATK_LOG_SITE_LOC(LogLevel::Info, "Adapter::send");
+    static constinit LogSiteLevel siteLevel;
+    CaptureLogger logger;
+
+    EXPECT_TRUE(logger.enabled(site, siteLevel));
+    logger.setLevel("Adapter", LogLevel::Error);
+    EXPECT_FALSE(logger.enabled(site, siteLevel));
+    logger.setLevel("Adapter::send", LogLevel::Info);
+    EXPECT_TRUE(logger.enabled(site, siteLevel));
+    logger.resetLevel("Adapter::send");
+    EXPECT_FALSE(logger.enabled(site, siteLevel));
+}
+
+TEST(Logger, MinLevel)
+{
+    CaptureLogger logger;
+    ILogger* previous = std::exchange(g_logger, &logger);
+
+    int evaluated = 0;
+    EATK_TRACE("compiled out {}", ++evaluated);
+    EXPECT_EQ(evaluated, 0);
+    EXPECT_EQ(logger.count(), 0u);
+
+    EATK_INFO("kept {}", ++evaluated);
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_EQ(logger.count(), 1u);
+    EXPECT_EQ(logger.message(), "kept 1");
+
+    // runtime levels skip the arguments as well
+    logger.setLevel(LogLevel::Warn);
+    EATK_INFO("filtered {}", ++evaluated);
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_EQ(logger.count(), 1u);
+
+    g_logger = previous;
+}
+
+// --- Sinks ---
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+static bool fileExists(const std::string& path)
+{
+    return std::ifstream(path).good();
+}
+
+TEST(LogSink, FileRotation)
+{
+    const std::string path = testing::TempDir() + "eatk_rotation.log";
+    for (const auto& file : { path, path + ".1", path + ".2", path + ".3" }) {
+        std::remove(file.c_str());
+    }
+
+    {
+        FileLogSink sink(path.c_str(), 32, 3);
+        ASSERT_TRUE(sink.isOpen());
+
+        // a batch that does not fit anymore starts a new file
+        sink.write(LogBatch{ "line 0 ....\n", {} });
+        sink.write(LogBatch{ "line 1 ....\n", {} });
+        EXPECT_EQ(sink.size(), 24u);
+        sink.write(LogBatch{ "line 2 ....\n", {} });
+        EXPECT_EQ(sink.size(), 12u);
+        EXPECT_EQ(readFile(path + ".1"), "line 0 ....\nline 1 ....\n");
+
+        sink.write(LogBatch{ "line 3 ....\n", {} });
+        sink.write(LogBatch{ "line 4 ....\n", {} });
+        sink.write(LogBatch{ "line 5 ....\n", {} });
+        sink.write(LogBatch{ "line 6 ....\n", {} });
+    }
+
+    // the oldest file is removed once maxFiles is reached
+    EXPECT_EQ(readFile(path), "line 6 ....\n");
+    EXPECT_EQ(readFile(path + ".1"), "line 4 ....\nline 5 ....\n");
+    EXPECT_EQ(readFile(path + ".2"), "line 2 ....\nline 3 ....\n");
+    EXPECT_FALSE(fileExists(path + ".3"));
+
+    // a reopened sink continues the current file
+    {
+        FileLogSink sink(path.c_str(), 32, 3);
+        EXPECT_EQ(sink.size(), 12u);
+    }
+
+    for (const auto& file : { path, path + ".1", path + ".2" }) {
+        std::remove(file.c_str());
+    }
+}
+
+TEST(LogSink, FileRotationSingleFile)
+{
+    const std::string path = testing::TempDir() + "eatk_rotation_single.log";
+    std::remove(path.c_str());
+
+    {
+        FileLogSink sink(path.c_str(), 16, 1);
+        sink.write(LogBatch{ "first line\n", {} });
+        sink.write(LogBatch{ "second line\n", {} });
+    }
+    EXPECT_EQ(readFile(path), "second line\n");
+    EXPECT_FALSE(fileExists(path + ".1"));
+
+    std::remove(path.c_str());
+}
+
+TEST(LogSink, FilePathTooLong)
+{
+    const std::string path(EATK_LOG_PATH_SIZE, 'p');
+    EXPECT_THROW(FileLogSink sink(path.c_str()), std::length_error);
+}
+
+TEST(LogSink, MemoryWrap)
+{
+    MemoryLogSink<16> sink;
+    sink.write(LogBatch{ "aaaa\nbbbb\n", {} });
+    auto parts = sink.contents();
+    EXPECT_EQ(parts[0], "aaaa\nbbbb\n");
+    EXPECT_TRUE(parts[1].empty());
+
+    // once wrapped the contents start at the first complete line
+    sink.write(LogBatch{ "cccc\ndddd\n", {} });
+    parts = sink.contents();
+    EXPECT_EQ(std::string(parts[0]) + std::string(parts[1]), "bbbb\ncccc\ndddd\n");
+
+    // an oversized batch keeps only its end
+    sink.write(LogBatch{ "eeee\nffff\ngggg\nhhhh\n", {} });
+    parts = sink.contents();
+    EXPECT_EQ(std::string(parts[0]) + std::string(parts[1]), "ffff\ngggg\nhhhh\n");
+
+    sink.clear();
+    parts = sink.contents();
+    EXPECT_TRUE(parts[0].empty());
+    EXPECT_TRUE(parts[1].empty());
+}
+
+TEST(LogSink, MemoryWrapWithinLine)
+{
+    // no line break in the older part, the newer part starts after the first one
+    MemoryLogSink<8> sink;
+    sink.write(LogBatch{ "abcdefg\n", {} });
+    sink.write(LogBatch{ "xyz\n", {} });
+    const auto parts = sink.contents();
+    EXPECT_EQ(std::string(parts[0]) + std::string(parts[1]), "xyz\n");
+}
+
+// Keeps the payload of every frame instead of sending it.
+class CaptureAdapter : public INetworkAdapter
+{
+public:
+    CaptureAdapter()
+        : INetworkAdapter(NetworkAdapterInfo{ "capture", "", MAC{0x02, 0, 0, 0, 0, 1} }) {}
+
+    std::expected<void, std::string> openSocket(EthType) override
+    {
+        m_open = true;
+        return {};
+    }
+
+    void closeSocket() override { m_open = false; }
+
+    std::expected<size_t, std::string> sendFrame(const uint8_t* data, size_t size) const override
+    {
+        frames.emplace_back(reinterpret_cast<const char*>(data), size);
+        return size;
+    }
+
+    std::expected<size_t, std::string> receiveFrame(uint8_t*, size_t) const override { return 0; }
+
+    mutable std::vector<std::string> frames;
+};
+
+TEST(LogSink, FrameHeader)
+{
+    CaptureAdapter adapter;
+    FrameLogSink sink(adapter);
+
+    // nothing is sent through a closed adapter
+    sink.write(LogBatch{ "line\n", {} });
+    EXPECT_TRUE(adapter.frames.empty());
+
+    ASSERT_TRUE(adapter.openSocket(EthType::IP));
+    sink.write(LogBatch{ "line\n", {} });
+    ASSERT_EQ(adapter.frames.size(), 1u);
+    EXPECT_EQ(sink.framesSent(), 1u);
+
+    const std::string& frame = adapter.frames[0];
+    ASSERT_EQ(frame.size(), FrameLogSink::HEADER_SIZE + 5);
+    EXPECT_EQ(frame.substr(0, 6), std::string(6, '\xFF'));
+    EXPECT_EQ(frame.substr(6, 6), std::string("\x02\0\0\0\0\x01", 6));
+    EXPECT_EQ(frame.substr(12, 2), "\x88\xB5");
+    EXPECT_EQ(frame.substr(FrameLogSink::HEADER_SIZE), "line\n");
+}
+
+TEST(LogSink, FrameLineBoundaries)
+{
+    CaptureAdapter adapter;
+    ASSERT_TRUE(adapter.openSocket(EthType::IP));
+    FrameLogSink sink(adapter);
+
+    // whole lines are packed into a frame as long as they fit
+    const std::string line = std::string(599, 'a') + '\n';
+    sink.write(LogBatch{ line + line + line, {} });
+    ASSERT_EQ(adapter.frames.size(), 2u);
+    EXPECT_EQ(adapter.frames[0].substr(FrameLogSink::HEADER_SIZE), line + line);
+    EXPECT_EQ(adapter.frames[1].substr(FrameLogSink::HEADER_SIZE), line);
+
+    // a line longer than a frame is split
+    adapter.frames.clear();
+    const std::string longLine = std::string(FrameLogSink::MAX_PAYLOAD + 100, 'b') + '\n';
+    sink.write(LogBatch{ longLine, {} });
+    ASSERT_EQ(adapter.frames.size(), 2u);
+    EXPECT_EQ(adapter.frames[0].size(), FrameLogSink::HEADER_SIZE + FrameLogSink::MAX_PAYLOAD);
+    EXPECT_EQ(adapter.frames[0].substr(FrameLogSink::HEADER_SIZE) + adapter.frames[1].substr(FrameLogSink::HEADER_SIZE), longLine);
+    EXPECT_EQ(sink.framesSent(), 4u);
+    EXPECT_EQ(sink.framesFailed(), 0u);
+}
+
+// --- Overflow Policies ---
+
+// Keeps the messages of all records, written from the logging thread.
+class CaptureSink : public ILogSink
+{
+public:
+    void write(const LogBatch& batch) override
+    {
+        std::scoped_lock lock(m_mutex);
+        for (const auto& record : batch.records) {
+            m_messages.emplace_back(record.message);
+        }
+    }
+
+    std::vector<std::string> waitFor(const size_t count)
+    {
+        for (int i = 0; i < 1000 && messages().size() < count; ++i) {
+            OSAL::sleep(1000);
+        }
+        return messages();
+    }
+
+    std::vector<std::string> messages()
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_messages;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_messages;
+};
+
+// The logging thread is only started once the queue was overloaded.
+class LoggerOverflow : public ::testing::Test
+{
+protected:
+    using SmallLogger = Logger<8, 16384, 2>;
+
+    void SetUp() override
+    {
+        logger.removeSink(logger.console());
+        logger.addSink(sink);
+    }
+
+    void TearDown() override
+    {
+        if (g_logger == &logger)
+            g_logger = nullptr;
+    }
+
+    void logMessages(const int count)
+    {
+        static constexpr LogSite site EATK_LOG_SITE_LOC(LogLevel::Info, "Test");
+        for (int i = 0; i < count; ++i) {
+            logger.log(site, true, "message {}", m_next++);
+        }
+    }
+
+    std::vector<std::string> startLogging(const size_t count)
+    {
+        g_logger = &logger;
+        logger.start();
+        return sink.waitFor(count);
+    }
+
+    CaptureSink sink;
+    SmallLogger logger{0};
+
+private:
+    int m_next = 0;
+};
+
+TEST_F(LoggerOverflow, DropNewest)
+{
+    logMessages(10);
+    const LogStats stats = logger.stats();
+    EXPECT_EQ(stats.enqueued, 8u);
+    EXPECT_EQ(stats.dropped, 2u);
+    EXPECT_EQ(stats.highWater, 8u);
+
+    const auto messages = startLogging(9);
+    ASSERT_EQ(messages.size(), 9u);
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(messages[i], std::format("message {}", i));
+    }
+    EXPECT_EQ(messages[8], "2 messages dropped");
+}
+
+TEST_F(LoggerOverflow, DropOldest)
+{
+    logger.setOverflowPolicy(LogOverflowPolicy::DropOldest);
+    logMessages(11);
+    const LogStats stats = logger.stats();
+    EXPECT_EQ(stats.enqueued, 11u);
+    EXPECT_EQ(stats.dropped, 3u);
+    EXPECT_EQ(stats.highWater, 8u);
+
+    const auto messages = startLogging(9);
+    ASSERT_EQ(messages.size(), 9u);
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(messages[i], std::format("message {}", i + 3));
+    }
+    EXPECT_EQ(messages[8], "3 messages dropped");
+}
+
+TEST_F(LoggerOverflow, Block)
+{
+    static constexpr uint32_t TIMEOUT_US = 2000;
+    logger.setOverflowPolicy(LogOverflowPolicy::Block, TIMEOUT_US);
+    logMessages(8);
+
+    // nobody consumes, the producer gives up after the timeout
+    const uint64_t start = OSAL::monotonicTime();
+    logMessages(1);
+    EXPECT_GE(OSAL::monotonicTime() - start, TIMEOUT_US);
+    EXPECT_EQ(logger.stats().enqueued, 8u);
+    EXPECT_EQ(logger.stats().dropped, 1u);
+
+    const auto messages = startLogging(9);
+    ASSERT_EQ(messages.size(), 9u);
+    EXPECT_EQ(messages[8], "1 messages dropped");
+}
+
+TEST_F(LoggerOverflow, Sample)
+{
+    // above 3/4 fill level only every 2nd message is queued
+    logger.setOverflowPolicy(LogOverflowPolicy::Sample, 2);
+    logMessages(10);
+    const LogStats stats = logger.stats();
+    EXPECT_EQ(stats.enqueued, 8u);
+    EXPECT_EQ(stats.dropped, 2u);
+
+    const auto messages = startLogging(9);
+    ASSERT_EQ(messages.size(), 9u);
+    const std::vector<std::string> expected{
+        "message 0", "message 1", "message 2", "message 3", "message 4", "message 5",
+        "message 6", "message 8", "2 messages dropped"
+    };
+    EXPECT_EQ(messages, expected);
+}
+
+TEST_F(LoggerOverflow, NoDropReport)
+{
+    logMessages(3);
+    const auto messages = startLogging(3);
+    EXPECT_EQ(messages.size(), 3u);
+    EXPECT_EQ(logger.stats().dropped, 0u);
+    EXPECT_EQ(logger.stats().enqueued, 3u);
+
+    // a report would follow the last batch right away
+    OSAL::sleep(10000);
+    EXPECT_EQ(sink.messages().size(), 3u);
+}
@@ -233,6 +233,132 @@ TEST_F(ContainersTest, StaticVector_MoveOperations)
 	}
 }
 
+TEST_F(ContainersTest, StaticVector_Fast)
+{
+	StaticVector<int, 5> v{1, 2, 3};
+
+	int sum = 0;
+	for (int i : v.fast()) {
+		sum += i;
+	}
+	EXPECT_EQ(sum, 6);
+
+	for (int& i : v.fast()) {
+		i *= 2;
+	}
+	EXPECT_EQ(v[2], 6);
+
+	const auto& cv = v;
+	EXPECT_EQ(cv.fast().size(), 3);
+	EXPECT_EQ(cv.fast().data(), cv.data());
+}
+
+//------------------------------------------------------
+//                      HybridVector
+//------------------------------------------------------
+TEST_F(ContainersTest, HybridVector_Spill)
+{
+	StaticMonotonicPool<int, 128> pool;
+	HybridVector<int, 4> v(pool);
+	EXPECT_EQ(v.capacity(), 4);
+
+	for (int i = 0; i < 4; ++i) {
+		v.push_back(i);
+	}
+	EXPECT_FALSE(v.spilled());
+	EXPECT_FALSE(v.full());
+
+	v.push_back(4);
+	EXPECT_TRUE(v.spilled());
+	EXPECT_EQ(v.capacity(), 8);
+	EXPECT_GE(static_cast<const void*>(v.data()), pool.data());
+
+	for (int i = 5; i < 20; ++i) {
+		v.push_back(i);
+	}
+	EXPECT_EQ(v.capacity(), 32);
+	for (int i = 0; i < 20; ++i) {
+		EXPECT_EQ(v[i], i);
+	}
+
+	// the new element may refer into the buffer that is replaced
+	v.resize(32, 31);
+	v.push_back(v[3]);
+	EXPECT_EQ(v.capacity(), 64);
+	EXPECT_EQ(v.back(), 3);
+
+	v.erase(1, 30);
+	EXPECT_EQ(v.size(), 3);
+	EXPECT_EQ(v[1], 31);
+	v.shrink_to_fit();
+	EXPECT_FALSE(v.spilled());
+	EXPECT_EQ(v.capacity(), 4);
+	EXPECT_EQ(v.back(), 3);
+
+	// without a pool it stays within its inline capacity
+	HybridVector<int, 2> fixed{1, 2};
+	EXPECT_TRUE(fixed.full());
+	EXPECT_THROW(fixed.push_back(3), std::length_error);
+	EXPECT_EQ(fixed.size(), 2);
+}
+
+TEST_F(ContainersTest, HybridVector_CopyMove)
+{
+	StaticMonotonicPool<int, 64> pool;
+	HybridVector<int, 2> v(pool);
+	v.resize(5, 7);
+
+	HybridVector<int, 2> copy = v;
+	EXPECT_EQ(copy.pool(), &pool);
+	EXPECT_TRUE(copy.spilled());
+	EXPECT_NE(copy.data(), v.data());
+	EXPECT_TRUE(std::ranges::equal(copy, v));
+
+	// a spilled buffer is moved without touching the elements
+	const int* data = v.data();
+	HybridVector<int, 2> moved = std::move(v);
+	EXPECT_EQ(moved.data(), data);
+	EXPECT_TRUE(v.empty());
+	EXPECT_FALSE(v.spilled());
+
+	// the pool moves along with the buffer
+	HybridVector<int, 2> fixed;
+	fixed = HybridVector<int, 2>{1, 2};
+	EXPECT_EQ(fixed[1], 2);
+	fixed = std::move(moved);
+	EXPECT_EQ(fixed.size(), 5);
+	EXPECT_EQ(fixed.data(), data);
+	EXPECT_EQ(fixed.pool(), &pool);
+
+	IVector<int>& handle = fixed;
+	handle.erase(handle.begin());
+	EXPECT_EQ(handle.size(), 4);
+}
+
+TEST_F(ContainersTest, HybridVector_WithTestCounter)
+{
+	{
+		StaticMonotonicPool<TestCounter, 64> pool;
+		HybridVector<TestCounter, 3> v(pool);
+		for (int i = 0; i < 10; ++i) {
+			v.emplace_back(i);
+		}
+		EXPECT_EQ(v[9].value, 9);
+
+		HybridVector<TestCounter, 3> copy = v;
+		copy.erase(copy.begin() + 2, copy.end());
+		copy.shrink_to_fit();
+		EXPECT_FALSE(copy.spilled());
+		EXPECT_EQ(copy.back().value, 1);
+
+		v.pop_back();
+		v.resize(2);
+		v = copy;
+		v.clear();
+	}
+	EXPECT_EQ(TestCounter::constructions, TestCounter::destructions);
+}
+
 //------------------------------------------------------
 //                      StaticQueue
 //------------------------------------------------------
@@ -655,6 +781,127 @@ TEST_F(ContainersTest, StaticQueue_InsertMove_NoWrap)
 	EXPECT_EQ(q1[3], 20);
 }
 
+TEST_F(ContainersTest, StaticQueue_Fast)
+{
+	StaticQueue<int, 3> q;
+	q.push(1);
+	q.push(2);
+	q.pop();
+	q.push(3);
+	q.push(4); // wrapped
+
+	std::vector<int> values;
+	for (int i : q.fast()) {
+		values.push_back(i);
+	}
+	EXPECT_EQ(values, (std::vector<int>{2, 3, 4}));
+
+	const auto& cq = q;
+	auto view = cq.fast();
+	EXPECT_EQ(view.size(), 3);
+	EXPECT_EQ(view[2], 4);
+	EXPECT_TRUE(std::ranges::equal(view, q));
+}
+
+TEST_F(ContainersTest, StaticQueue_Segments)
+{
+	StaticQueue<int, 4> q;
+	auto segments = q.segments();
+	EXPECT_TRUE(segments[0].empty());
+	EXPECT_TRUE(segments[1].empty());
+
+	q.push(1);
+	q.push(2);
+	q.push(3);
+	segments = q.segments();
+	EXPECT_TRUE(std::ranges::equal(segments[0], std::array{1, 2, 3}));
+	EXPECT_TRUE(segments[1].empty());
+
+	q.pop();
+	q.pop();
+	q.push(4);
+	q.push(5); // wrapped
+	segments = q.segments();
+	EXPECT_TRUE(std::ranges::equal(segments[0], std::array{3, 4}));
+	EXPECT_TRUE(std::ranges::equal(segments[1], std::array{5}));
+}
+
+TEST_F(ContainersTest, StaticQueue_NonPowerOfTwo)
+{
+	static_assert(StaticQueue<int, 4>::POWER_OF_TWO);
+	static_assert(!StaticQueue<int, 3>::POWER_OF_TWO);
+
+	StaticQueue<int, 3> q;
+	for (int i = 0; i < 10; ++i) {
+		EXPECT_TRUE(q.push(i));
+		EXPECT_TRUE(q.push(i + 100));
+		EXPECT_EQ(q.pop().value(), i);
+		EXPECT_EQ(q[0], i + 100);
+		EXPECT_EQ(q.pop().value(), i + 100);
+	}
+	EXPECT_TRUE(q.empty());
+
+	// the bulk operations wrap the same way, also when called through the interface
+	IQueue<int>& handle = q;
+	const std::array<int, 2> in{1, 2};
+	for (int i = 0; i < 3; ++i) {
+		std::array<int, 2> out{};
+		EXPECT_TRUE(handle.pushN(in));
+		EXPECT_EQ(handle.popN(out), 2u);
+		EXPECT_EQ(out, in);
+	}
+	EXPECT_TRUE(q.pushN(in)); // wraps
+	const auto segments = q.segments();
+	EXPECT_TRUE(std::ranges::equal(segments[0], std::array{1}));
+	EXPECT_TRUE(std::ranges::equal(segments[1], std::array{2}));
+
+	int sum = 0;
+	EXPECT_EQ(handle.consume([&sum](int&& value) { sum += value; }), 2u);
+	EXPECT_EQ(sum, 3);
+	EXPECT_TRUE(q.empty());
+}
+
+TEST_F(ContainersTest, StaticQueue_BulkPushPop)
+{
+	StaticQueue<int, 4> q;
+	q.push(0);
+	q.push(0);
+	q.pop();
+	q.pop(); // head and tail at index 2
+
+	const std::array<int, 3> in{1, 2, 3};
+	EXPECT_TRUE(q.pushN(in)); // wraps
+	EXPECT_FALSE(q.pushN(in)); // all or nothing
+	EXPECT_EQ(q.size(), 3);
+
+	std::array<int, 2> out{};
+	EXPECT_EQ(q.popN(out), 2);
+	EXPECT_EQ(out, (std::array{1, 2}));
+	EXPECT_EQ(q.popN(out), 1);
+	EXPECT_EQ(out[0], 3);
+	EXPECT_EQ(q.popN(out), 0);
+}
+
+TEST_F(ContainersTest, StaticQueue_BulkWithTestCounter)
+{
+	{
+		StaticQueue<TestCounter, 4> q;
+		std::array<TestCounter, 3> in{1, 2, 3};
+
+		EXPECT_TRUE(q.pushN(std::make_move_iterator(in.data()), std::make_move_iterator(in.data() + in.size())));
+		EXPECT_EQ(TestCounter::moves, 3);
+		EXPECT_EQ(TestCounter::copies, 0);
+
+		int sum = 0;
+		IQueue<TestCounter>& handle = q;
+		EXPECT_EQ(handle.consume([&sum](TestCounter&& c) { sum += c.value; }, 2), 2);
+		EXPECT_EQ(sum, 3);
+		EXPECT_EQ(q.size(), 1);
+		EXPECT_EQ(q.peek()->get().value, 3);
+	}
+	EXPECT_EQ(TestCounter::constructions, TestCounter::destructions);
+}
+
 //------------------------------------------------------
 //                      StaticStdVector
 //------------------------------------------------------
@@ -889,6 +1136,154 @@ TEST_F(ContainersTest, StaticStdQueue_MoveOperations)
 	}
 }
 
+//------------------------------------------------------
+//                      StaticDeque
+//------------------------------------------------------
+TEST_F(ContainersTest, StaticDeque_BothEnds)
+{
+	StaticDeque<int, 4> d;
+	EXPECT_FALSE(d.pop_back().has_value());
+	EXPECT_THROW(d.front(), std::length_error);
+
+	EXPECT_TRUE(d.push_back(2));
+	EXPECT_TRUE(d.push_front(1));
+	EXPECT_TRUE(d.push_back(3));
+	EXPECT_TRUE(d.emplace_front(0).has_value());
+	EXPECT_FALSE(d.push_front(-1)); // full
+	EXPECT_FALSE(d.push_back(4));
+
+	ASSERT_EQ(d.size(), 4);
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_EQ(d[i], i);
+	}
+	EXPECT_EQ(d.front(), 0);
+	EXPECT_EQ(d.back(), 3);
+
+	EXPECT_EQ(d.pop_back().value(), 3);
+	EXPECT_EQ(d.pop_front().value(), 0);
+	EXPECT_EQ(d.pop().value(), 1); // FIFO pop takes the front
+	EXPECT_EQ(d.pop_back().value(), 2);
+	EXPECT_TRUE(d.empty());
+}
+
+TEST_F(ContainersTest, StaticDeque_Churn)
+{
+	// alternating ends walk head and tail around the ring in both directions
+	StaticDeque<int, 5> d;
+	std::deque<int> reference;
+	for (int i = 0; i < 1000; ++i) {
+		switch (i % 7) {
+			case 0: case 3:
+				EXPECT_EQ(d.push_back(i), reference.size() < 5);
+				if (reference.size() < 5) reference.push_back(i);
+				break;
+			case 1: case 5:
+				EXPECT_EQ(d.push_front(i), reference.size() < 5);
+				if (reference.size() < 5) reference.push_front(i);
+				break;
+			case 2: EXPECT_EQ(d.pop_front(), reference.front()); reference.pop_front(); break;
+			case 4: EXPECT_EQ(d.pop_back(), reference.back()); reference.pop_back(); break;
+			case 6: if (!reference.empty()) { EXPECT_EQ(d.pop_back(), reference.back()); reference.pop_back(); } break;
+		}
+		ASSERT_EQ(d.size(), reference.size());
+		EXPECT_TRUE(std::ranges::equal(d.fast(), reference));
+	}
+}
+
+TEST_F(ContainersTest, StaticDeque_WithTestCounter)
+{
+	{
+		StaticDeque<TestCounter, 4> d;
+		d.push_front(TestCounter(1));
+		d.push_back(TestCounter(2));
+		d.emplace_front(0);
+		d.pop_back();
+		d.push_front(TestCounter(-1));
+		d.push_front(TestCounter(-2));
+		EXPECT_TRUE(d.full());
+
+		StaticDeque<TestCounter, 4> copy = d;
+		EXPECT_EQ(copy.front().value, -2);
+		EXPECT_EQ(copy.back().value, 1);
+
+		// clear and resize with the head wrapped and the ring full
+		d.resize(2);
+		EXPECT_EQ(d.back().value, -1);
+		d.resize(4, TestCounter(7));
+		EXPECT_EQ(d.back().value, 7);
+		d.clear();
+		EXPECT_TRUE(d.empty());
+	}
+	EXPECT_EQ(TestCounter::constructions, TestCounter::destructions);
+}
+
+//------------------------------------------------------
+//                 StaticWorkStealingDeque
+//------------------------------------------------------
+TEST_F(ContainersTest, StaticWorkStealingDeque_Ends)
+{
+	StaticWorkStealingDeque<int*, 4> d;
+	std::array<int, 5> values{ 0, 1, 2, 3, 4 };
+	EXPECT_FALSE(d.pop().has_value());
+	EXPECT_FALSE(d.steal().has_value());
+
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_TRUE(d.push(&values[i]));
+	}
+	EXPECT_FALSE(d.push(&values[4])); // full
+	EXPECT_EQ(d.size(), 4);
+
+	// owner works LIFO at the bottom, thieves FIFO at the top
+	EXPECT_EQ(*d.pop().value(), 3);
+	EXPECT_EQ(*d.steal().value(), 0);
+	EXPECT_EQ(*d.steal().value(), 1);
+	EXPECT_EQ(*d.pop().value(), 2);
+	EXPECT_TRUE(d.empty());
+	EXPECT_FALSE(d.pop().has_value());
+
+	// positions keep growing, the ring wraps
+	for (int i = 0; i < 10; ++i) {
+		EXPECT_TRUE(d.push(&values[i % 5]));
+		EXPECT_EQ(*d.steal().value(), i % 5);
+	}
+}
+
+TEST_F(ContainersTest, StaticWorkStealingDeque_Concurrent)
+{
+	constexpr size_t ITEMS = 100000;
+	constexpr size_t THIEVES = 3;
+
+	StaticWorkStealingDeque<size_t, 64> d;
+	std::vector<std::atomic_uint8_t> taken(ITEMS);
+	std::atomic_bool done = false;
+
+	auto take = [&taken](const size_t item) { taken[item].fetch_add(1, std::memory_order_relaxed); };
+
+	std::vector<std::thread> thieves;
+	for (size_t t = 0; t < THIEVES; ++t) {
+		thieves.emplace_back([&]() {
+			while (!done.load(std::memory_order_acquire) || !d.empty()) {
+				if (auto item = d.steal()) take(*item);
+			}
+		});
+	}
+
+	// the owner pops every other round so the last element is raced for
+	for (size_t i = 0; i < ITEMS; ++i) {
+		while (!d.push(i)) {
+			if (auto item = d.pop()) take(*item);
+		}
+		if (i % 2 == 0) {
+			if (auto item = d.pop()) take(*item);
+		}
+	}
+	while (auto item = d.pop()) take(*item);
+	done.store(true, std::memory_order_release);
+	for (auto& thief : thieves) thief.join();
+
+	EXPECT_TRUE(std::ranges::all_of(taken, [](const std::atomic_uint8_t& count) { return count.load() == 1; }));
+}
+
 //------------------------------------------------------
 //                      StaticStdMap
 //------------------------------------------------------
@@ -985,6 +1380,585 @@ TEST_F(ContainersTest, StaticStdMap_MoveOperations)
     }
 }
 
+//------------------------------------------------------
+//                      StaticFlatMap
+//------------------------------------------------------
+TEST_F(ContainersTest, StaticFlatMap_Lifecycle)
+{
+    StaticFlatMap<int, int, 5> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.capacity(), 5);
+
+    EXPECT_TRUE(map.insert({1, 100}).second);
+    EXPECT_FALSE(map.insert({1, 101}).second);
+    map[2] = 200;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(1), 100);
+    EXPECT_EQ(map[2], 200);
+    EXPECT_TRUE(map.contains(2));
+    EXPECT_FALSE(map.contains(3));
+
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.erase(1), 0);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_THROW(map.at(1), std::out_of_range);
+
+    map[3] = 300;
+    map[4] = 400;
+    map[5] = 500;
+    map[6] = 600;
+    EXPECT_TRUE(map.full());
+    EXPECT_THROW(map[7], std::length_error);
+
+    int sum = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(value, key * 100);
+        sum += key;
+    }
+    EXPECT_EQ(sum, 2 + 3 + 4 + 5 + 6);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST_F(ContainersTest, StaticFlatMap_InsertErase)
+{
+    // mirrors a std::map through colliding inserts and erases
+    StaticFlatMap<uint32_t, uint32_t, 64> map;
+    std::map<uint32_t, uint32_t> reference;
+
+    uint32_t seed = 1;
+    for (int i = 0; i < 5000; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const uint32_t key = (seed >> 8) % 128 * 16;
+        if (reference.contains(key)) {
+            EXPECT_EQ(map.at(key), reference.at(key));
+            EXPECT_EQ(map.erase(key), 1);
+            reference.erase(key);
+        }
+        else if (!map.full()) {
+            map[key] = i;
+            reference[key] = i;
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+
+    for (const auto& [key, value] : reference) {
+        EXPECT_EQ(map.at(key), value);
+    }
+    EXPECT_EQ(static_cast<size_t>(std::ranges::distance(map)), reference.size());
+}
+
+TEST_F(ContainersTest, StaticFlatMap_WithTestCounter)
+{
+    {
+        StaticFlatMap<int, TestCounter, 8> map;
+        for (int i = 0; i < 8; ++i) {
+            map.emplace(i, i * 10);
+        }
+        map.erase(3);
+        map.erase(0);
+
+        StaticFlatMap<int, TestCounter, 8> copy = map;
+        EXPECT_EQ(copy.size(), 6);
+        EXPECT_EQ(copy.at(7).value, 70);
+
+        StaticFlatMap<int, TestCounter, 8> moved = std::move(map);
+        EXPECT_EQ(moved.size(), 6);
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(moved.at(1).value, 10);
+    }
+    EXPECT_EQ(TestCounter::constructions, TestCounter::destructions);
+}
+
+// keys below 1000 share one hash, the others a second one homed in the next bucket
+struct ClusterHash
+{
+    inline static size_t low = 0;
+    inline static size_t high = 0;
+
+    size_t operator()(const uint32_t key) const noexcept { return key < 1000 ? low : high; }
+};
+
+TEST_F(ContainersTest, StaticFlatMap_ProbeOverflowLeavesMapUnchanged)
+{
+    using Map = StaticFlatMap<uint32_t, uint32_t, 300, ClusterHash>;
+    constexpr size_t SLOTS = Map::Table::SLOTS;
+    for (size_t hash = 0; ClusterHash::low == 0 || ClusterHash::high == 0; ++hash) {
+        const size_t bucket = detail::fibonacciBucket<SLOTS>(hash);
+        if (bucket == 1 && ClusterHash::low == 0) ClusterHash::low = hash;
+        if (bucket == 2 && ClusterHash::high == 0) ClusterHash::high = hash;
+    }
+
+    // 254 keys in a row behind the low bucket, each one slot further from home
+    Map map;
+    for (uint32_t key = 1000; key < 1254; ++key) {
+        map[key] = key;
+    }
+    // the second low key displaces the high cluster by one, up to the longest distance there is
+    map[0] = 0;
+    map[1] = 1;
+    ASSERT_EQ(map.size(), 256u);
+
+    // the third one would displace a resident and then run out of distance further down the chain
+    EXPECT_THROW(map[2], std::length_error);
+    EXPECT_EQ(map.size(), 256u);
+    EXPECT_FALSE(map.contains(2));
+    for (uint32_t key = 1000; key < 1254; ++key) {
+        ASSERT_TRUE(map.contains(key));
+        EXPECT_EQ(map.at(key), key);
+    }
+    EXPECT_EQ(map.at(0), 0u);
+    EXPECT_EQ(map.at(1), 1u);
+    EXPECT_EQ(static_cast<size_t>(std::ranges::distance(map)), map.size());
+}
+
+//------------------------------------------------------
+//                      StaticSortedMap
+//------------------------------------------------------
+TEST_F(ContainersTest, StaticSortedMap_Lifecycle)
+{
+    StaticSortedMap<int, int, 4> map;
+    EXPECT_TRUE(map.empty());
+
+    map[30] = 3;
+    map[10] = 1;
+    EXPECT_TRUE(map.insert({20, 2}).second);
+    EXPECT_FALSE(map.insert({20, 5}).second);
+    map[40] = 4;
+    EXPECT_TRUE(map.full());
+    EXPECT_THROW(map[50], std::length_error);
+
+    // iterates in key order
+    int expected = 1;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(key, expected * 10);
+        EXPECT_EQ(value, expected++);
+    }
+
+    EXPECT_EQ(map.erase(20), 1);
+    EXPECT_FALSE(map.contains(20));
+    EXPECT_EQ(map.at(30), 3);
+    EXPECT_THROW(map.at(20), std::out_of_range);
+}
+
+TEST_F(ContainersTest, StaticSortedMap_WithTestCounter)
+{
+    {
+        StaticSortedMap<int, TestCounter, 5> map;
+        map.emplace(3, 30);
+        map.emplace(1, 10);
+        map.emplace(2, 20);
+        map.erase(1);
+
+        StaticSortedMap<int, TestCounter, 5> copy = map;
+        EXPECT_EQ(copy.at(2).value, 20);
+
+        StaticSortedMap<int, TestCounter, 5> moved = std::move(map);
+        EXPECT_EQ(moved.size(), 2);
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(moved.at(3).value, 30);
+    }
+    EXPECT_EQ(TestCounter::constructions, TestCounter::destructions);
+}
+
+//------------------------------------------------------
+//                      StaticFlatSet
+//------------------------------------------------------
+TEST_F(ContainersTest, StaticFlatSet_Lifecycle)
+{
+    StaticFlatSet<int, 4> set;
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_FALSE(set.insert(2));
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_TRUE(set.contains(1));
+
+    EXPECT_EQ(set.erase(1), 1);
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_EQ(std::ranges::distance(set), 1);
+    EXPECT_EQ(*set.begin(), 2);
+}
+
+//------------------------------------------------------
+//                      ConstexprMap
+//------------------------------------------------------
+enum class TestColor { Red, Green, Blue };
+
+TEST_F(ContainersTest, ConstexprMap_Lookup)
+{
+    static constexpr auto map = makeStaticPerfectMap<uint16_t, int>({
+        {0x1000, 1}, {0x1001, 2}, {0x1008, 3}, {0x1018, 4}, {0x6040, 5}, {0x6041, 6}, {0x607A, 7}
+    });
+    static_assert(map.size() == 7);
+    static_assert(map.at(0x6041) == 6);
+    static_assert(!map.contains(0x2000));
+
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(map.at(key), value);
+    }
+    EXPECT_EQ(map.find(0x1009), nullptr);
+    EXPECT_THROW(map.at(0x1009), std::out_of_range);
+}
+
+TEST_F(ContainersTest, ConstexprMap_KeyTypes)
+{
+    static constexpr auto colors = makeStaticPerfectMap<TestColor, std::string_view>({
+        {TestColor::Red, "red"}, {TestColor::Green, "green"}, {TestColor::Blue, "blue"}
+    });
+    EXPECT_EQ(colors.at(TestColor::Green), "green");
+
+    static constexpr auto names = makeStaticPerfectMap<std::string_view, TestColor>({
+        {"red", TestColor::Red}, {"green", TestColor::Green}, {"blue", TestColor::Blue}
+    });
+    EXPECT_EQ(names.at("blue"), TestColor::Blue);
+    EXPECT_FALSE(names.contains("yellow"));
+}
+
+TEST_F(ContainersTest, ConstexprMap_ManyKeys)
+{
+    static constexpr auto map = ConstexprMap<uint32_t, uint32_t, 256>([] {
+        std::array<std::pair<uint32_t, uint32_t>, 256> entries{};
+        for (uint32_t i = 0; i < entries.size(); ++i) {
+            entries[i] = {i * 0x10, i};
+        }
+        return entries;
+    }());
+
+    for (uint32_t i = 0; i < 256; ++i) {
+        EXPECT_EQ(map.at(i * 0x10), i);
+        EXPECT_FALSE(map.contains(i * 0x10 + 1));
+    }
+}
+
+//------------------------------------------------------
+//                      StaticSoAVector
+//------------------------------------------------------
+struct SoAAxis
+{
+    uint16_t id;
+    double actualPosition;
+    float actualVelocity;
+};
+
+TEST_F(ContainersTest, StaticSoAVector_Lifecycle)
+{
+    using Axes = StaticSoAVector<SoAAxis, 8>;
+    static_assert(Axes::FIELDS == 3);
+    static_assert(Axes::field("actualPosition") == 1);
+    static_assert(std::is_same_v<Axes::FieldType<2>, float>);
+    static_assert(std::ranges::random_access_range<Axes>);
+    static_assert(std::ranges::random_access_range<const Axes>);
+
+    Axes axes{ {1, 1.5, 0.5f}, {2, 2.5, 1.5f} };
+    EXPECT_EQ(axes.size(), 2);
+    EXPECT_EQ(axes.capacity(), 8);
+
+    axes.push_back({3, 3.5, 2.5f});
+    EXPECT_EQ(axes.size(), 3);
+
+    // proxies read and write single members or whole elements
+    EXPECT_EQ(axes[1].get<0>(), 2);
+    axes[1].get<1>() = 20.0;
+    const SoAAxis axis = axes[1];
+    EXPECT_EQ(axis.id, 2);
+    EXPECT_EQ(axis.actualPosition, 20.0);
+    axes[0] = SoAAxis{10, 10.5, 5.0f};
+    EXPECT_EQ(axes.front().get<0>(), 10);
+    EXPECT_EQ(axes.back().get<2>(), 2.5f);
+
+    uint16_t idSum = 0;
+    for (auto ref : axes) {
+        idSum += ref.get<0>();
+    }
+    EXPECT_EQ(idSum, 15);
+
+    axes.erase(0);
+    ASSERT_EQ(axes.size(), 2);
+    EXPECT_EQ(axes[0].get<0>(), 2);
+    EXPECT_EQ(axes[1].get<0>(), 3);
+
+    axes.pop_back();
+    EXPECT_EQ(axes.size(), 1);
+    EXPECT_THROW(axes.at(1), std::out_of_range);
+
+    axes.clear();
+    EXPECT_TRUE(axes.empty());
+    EXPECT_THROW(axes.front(), std::length_error);
+}
+
+TEST_F(ContainersTest, StaticSoAVector_Columns)
+{
+    using Axes = StaticSoAVector<SoAAxis, 100>;
+    Axes axes;
+    axes.resize(100);
+
+    // every column starts on its own cache line
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(axes.column<0>().data()) % EATK_CACHE_LINE_SIZE, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(axes.column<1>().data()) % EATK_CACHE_LINE_SIZE, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(axes.column<2>().data()) % EATK_CACHE_LINE_SIZE, 0);
+
+    auto positions = axes.column<Axes::field("actualPosition")>();
+    ASSERT_EQ(positions.size(), 100);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        positions[i] = static_cast<double>(i);
+    }
+    for (auto& velocity : axes.column<2>()) {
+        velocity = 2.0f;
+    }
+
+    EXPECT_EQ(static_cast<SoAAxis>(axes[42]).actualPosition, 42.0);
+    EXPECT_EQ(static_cast<SoAAxis>(axes[42]).actualVelocity, 2.0f);
+
+    const Axes& constAxes = axes;
+    double sum = 0.0;
+    for (const double position : constAxes.column<1>()) {
+        sum += position;
+    }
+    EXPECT_EQ(sum, 4950.0);
+
+    EXPECT_THROW(axes.resize(101), std::length_error);
+    axes.resize(10);
+    EXPECT_EQ(axes.column<0>().size(), 10);
+}
+
+TEST_F(ContainersTest, StaticSoAVector_WithTestCounter)
+{
+    struct Element
+    {
+        int id;
+        TestCounter counter;
+    };
+
+    {
+        StaticSoAVector<Element, 8> elements;
+        for (int i = 0; i < 6; ++i) {
+            elements.push_back({i, TestCounter(i * 10)});
+        }
+        elements.erase(1, 2);
+        ASSERT_EQ(elements.size(), 4);
+        EXPECT_EQ(elements[1].get<1>().value, 30);
+
+        StaticSoAVector<Element, 8> copy = elements;
+        EXPECT_EQ(copy.size(), 4);
+        EXPECT_EQ(copy[3].get<1>().value, 50);
+
+        StaticSoAVector<Element, 8> moved = std::move(elements);
+        EXPECT_EQ(moved.size(), 4);
+        EXPECT_TRUE(elements.empty());
+
+        copy = moved;
+        moved.pop_back();
+        EXPECT_EQ(moved.size(), 3);
+    }
+    EXPECT_EQ(TestCounter::constructions, TestCounter::destructions);
+}
+
+//------------------------------------------------------
+//                   Intrusive Containers
+//------------------------------------------------------
+struct IntrusiveItem
+{
+    int key = 0;
+    IntrusiveListHook<IntrusiveItem> listHook;
+    IntrusiveHeapHook<IntrusiveItem> heapHook;
+    IntrusiveHashHook<IntrusiveItem> hashHook;
+
+    bool operator<(const IntrusiveItem& other) const { return key < other.key; }
+};
+
+TEST_F(ContainersTest, IntrusiveList_Lifecycle)
+{
+    std::array<IntrusiveItem, 4> items{};
+    for (int i = 0; i < 4; ++i) {
+        items[i].key = i;
+    }
+
+    IntrusiveList<IntrusiveItem, &IntrusiveItem::listHook> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.pop_front(), nullptr);
+
+    list.push_back(items[1]);
+    list.push_back(items[2]);
+    list.push_front(items[0]);
+    list.insert(nullptr, items[3]);
+    ASSERT_EQ(list.size(), 4);
+    EXPECT_TRUE(list.contains(items[2]));
+
+    int expected = 0;
+    for (const auto& item : list) {
+        EXPECT_EQ(item.key, expected++);
+    }
+    EXPECT_EQ(std::prev(list.end())->key, 3);
+
+    EXPECT_EQ(list.erase(items[1]), &items[2]);
+    EXPECT_FALSE(list.contains(items[1]));
+    EXPECT_EQ(list.pop_back(), &items[3]);
+    EXPECT_EQ(list.pop_front(), &items[0]);
+    ASSERT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front(), &items[2]);
+    EXPECT_EQ(list.back(), &items[2]);
+
+    // a copy of a linked object starts unlinked
+    const IntrusiveItem copy = items[2];
+    EXPECT_FALSE(list.contains(copy));
+
+    list.insert(&items[2], items[1]);
+    EXPECT_EQ(list.front(), &items[1]);
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.contains(items[2]));
+}
+
+TEST_F(ContainersTest, IntrusivePairingHeap_Order)
+{
+    constexpr int COUNT = 64;
+    std::array<IntrusiveItem, COUNT> items{};
+    IntrusivePairingHeap<IntrusiveItem, &IntrusiveItem::heapHook> heap;
+    EXPECT_EQ(heap.pop(), nullptr);
+
+    for (int i = 0; i < COUNT; ++i) {
+        items[i].key = (i * 37) % COUNT;
+        heap.push(items[i]);
+    }
+    ASSERT_EQ(heap.size(), COUNT);
+    EXPECT_EQ(heap.top()->key, 0);
+
+    // erase every third element, including inner nodes and the root
+    int erased = 0;
+    for (int i = 0; i < COUNT; i += 3) {
+        heap.erase(items[i]);
+        EXPECT_FALSE(heap.contains(items[i]));
+        ++erased;
+    }
+    EXPECT_EQ(heap.size(), COUNT - erased);
+
+    int last = -1;
+    while (IntrusiveItem* item = heap.pop()) {
+        EXPECT_GT(item->key, last);
+        EXPECT_FALSE(heap.contains(*item));
+        last = item->key;
+    }
+    EXPECT_TRUE(heap.empty());
+
+    // re-push after an update
+    heap.push(items[0]);
+    heap.push(items[1]);
+    heap.erase(items[1]);
+    items[1].key = -1;
+    heap.push(items[1]);
+    EXPECT_EQ(heap.top(), &items[1]);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(items[0]));
+}
+
+TEST_F(ContainersTest, IntrusiveHashTable_Lifecycle)
+{
+    constexpr int COUNT = 32;
+    std::array<IntrusiveItem, COUNT> items{};
+    IntrusiveHashTable<IntrusiveItem, &IntrusiveItem::hashHook, &IntrusiveItem::key, 8> table;
+    EXPECT_EQ(table.bucketCount(), 8);
+
+    for (int i = 0; i < COUNT; ++i) {
+        items[i].key = i * 0x10;
+        EXPECT_TRUE(table.insert(items[i]));
+    }
+    ASSERT_EQ(table.size(), COUNT);
+
+    IntrusiveItem duplicate{ .key = 0x20, .listHook = {}, .heapHook = {}, .hashHook = {} };
+    EXPECT_FALSE(table.insert(duplicate));
+
+    EXPECT_EQ(table.find(0x30), &items[3]);
+    EXPECT_EQ(table.find(0x31), nullptr);
+    EXPECT_TRUE(table.contains(0x1F0));
+
+    EXPECT_EQ(table.erase(0x30), &items[3]);
+    EXPECT_EQ(table.erase(0x30), nullptr);
+    table.erase(items[4]);
+    EXPECT_FALSE(table.contains(0x40));
+    EXPECT_EQ(table.size(), COUNT - 2);
+
+    int sum = 0;
+    size_t visited = 0;
+    for (const auto& item : std::as_const(table)) {
+        sum += item.key;
+        ++visited;
+    }
+    EXPECT_EQ(visited, table.size());
+    EXPECT_EQ(sum, 0x10 * (COUNT * (COUNT - 1) / 2) - 0x30 - 0x40);
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.begin(), table.end());
+    EXPECT_TRUE(table.insert(items[3]));
+}
+
+//------------------------------------------------------
+//                      Static String
+//------------------------------------------------------
+TEST_F(ContainersTest, StaticString_Lifecycle)
+{
+    StaticString<8> str;
+    EXPECT_TRUE(str.empty());
+    EXPECT_EQ(str.capacity(), 8);
+    EXPECT_STREQ(str.c_str(), "");
+
+    str.append("eth");
+    str.push_back('0');
+    EXPECT_EQ(str.size(), 4);
+    EXPECT_EQ(str, "eth0");
+    EXPECT_STREQ(str.c_str(), "eth0");
+    EXPECT_EQ(str.front(), 'e');
+    EXPECT_EQ(str.back(), '0');
+    EXPECT_TRUE(str.starts_with("eth"));
+    EXPECT_TRUE(str.contains("h0"));
+
+    str += ".100";
+    EXPECT_TRUE(str.full());
+    EXPECT_THROW(str.push_back('x'), std::length_error);
+    EXPECT_THROW(str.append("x"), std::length_error);
+    EXPECT_EQ(str, "eth0.100");
+
+    str.pop_back();
+    EXPECT_EQ(str, "eth0.10");
+    str.resize(3);
+    EXPECT_STREQ(str.c_str(), "eth");
+    str.resize(5, '-');
+    EXPECT_EQ(str, "eth--");
+    EXPECT_THROW(str.at(5), std::out_of_range);
+
+    const StaticString<16> copy = str;
+    EXPECT_EQ(copy.view(), str.view());
+    EXPECT_LT(copy, "ethz");
+    EXPECT_THROW(StaticString<4>("too long"), std::length_error);
+
+    str.clear();
+    EXPECT_TRUE(str.empty());
+    EXPECT_THROW(str.back(), std::length_error);
+}
+
+TEST_F(ContainersTest, StaticString_Format)
+{
+    StaticString<16> str;
+    EXPECT_TRUE(formatTo(str, "axis{}", 3));
+    EXPECT_TRUE(formatTo(str, ": {:.1f}", 1.25));
+    EXPECT_EQ(str, "axis3: 1.2");
+
+    // cut off at the capacity
+    EXPECT_FALSE(formatTo(str, " mm/s {}", 123456));
+    EXPECT_EQ(str, "axis3: 1.2 mm/s ");
+    EXPECT_STREQ(str.c_str(), "axis3: 1.2 mm/s ");
+
+    const auto name = staticFormat<8>("{}-{}", "node", 42);
+    EXPECT_EQ(name, "node-42");
+    EXPECT_EQ(std::format("[{}]", name), "[node-42]");
+}
+
 //------------------------------------------------------
 //                      Interoperability
 //------------------------------------------------------
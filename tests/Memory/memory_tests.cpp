@@ -455,6 +455,176 @@ TEST(StaticBlockPoolTest, InvalidOperations)
 	pool.deallocate(p, sizeof(long), alignof(long));
 }
 
+TEST(StaticBlockPoolTest, ClearPolicyZero)
+{
+	constexpr auto blockData = allocData<std::array<uint32_t, 4>>();
+	StaticBlockPool<2, blockData, ClearPolicy::Zero> pool;
+
+	auto* p = static_cast<uint32_t*>(pool.allocate(blockData.size, blockData.align));
+	std::fill_n(p, 4, 0xAAAAAAAA);
+	pool.deallocate(p, blockData.size, blockData.align);
+
+	// the free list link lives in the first bytes, the rest must be cleared
+	const auto* bytes = reinterpret_cast<const std::byte*>(p);
+	for (size_t i = sizeof(void*); i < blockData.size; ++i) {
+		EXPECT_EQ(bytes[i], std::byte{0x00});
+	}
+}
+
+TEST(StaticBlockPoolTest, ClearPolicyPoison)
+{
+	constexpr auto blockData = allocData<std::array<uint32_t, 4>>();
+	StaticBlockPool<1, blockData, ClearPolicy::Poison> pool;
+
+	auto* p = static_cast<uint32_t*>(pool.allocate(blockData.size, blockData.align));
+	std::fill_n(p, 4, 0xAAAAAAAA);
+	pool.deallocate(p, blockData.size, blockData.align);
+
+	const auto* bytes = reinterpret_cast<const std::byte*>(p);
+	for (size_t i = sizeof(void*); i < blockData.size; ++i) {
+		EXPECT_EQ(bytes[i], POOL_POISON_VALUE);
+	}
+
+	// untouched block can be reused
+	p = static_cast<uint32_t*>(pool.allocate(blockData.size, blockData.align));
+	pool.deallocate(p, blockData.size, blockData.align);
+
+	// use after free is detected on the next allocation
+	p[3] = 42;
+	EXPECT_THROW(pool.allocate(blockData.size, blockData.align), std::logic_error);
+}
+
+TEST(StaticBlockPoolTest, ClearPolicyNone)
+{
+	constexpr auto blockData = allocData<std::array<uint32_t, 4>>();
+	StaticBlockPool<1, blockData, ClearPolicy::None> pool;
+
+	auto* p = static_cast<uint32_t*>(pool.allocate(blockData.size, blockData.align));
+	std::fill_n(p, 4, 0xAAAAAAAA);
+	pool.deallocate(p, blockData.size, blockData.align);
+
+	EXPECT_EQ(p[3], 0xAAAAAAAA);
+	EXPECT_EQ(pool.allocate(blockData.size, blockData.align), p);
+}
+
+// --- ConcurrentBlockPool ---
+TEST(ConcurrentBlockPoolTest, AllocateAllBlocks)
+{
+	constexpr auto blockData = allocData<double>();
+	ConcurrentBlockPool<5, blockData> pool;
+	std::vector<void*> allocations;
+
+	for (int i = 0; i < 5; ++i)
+	{
+		void* p = pool.allocate(sizeof(double), alignof(double));
+		ASSERT_NE(p, nullptr);
+		EXPECT_GE(p, pool.data());
+		EXPECT_LT(p, static_cast<const std::byte*>(pool.data()) + 5*blockData.size);
+		allocations.push_back(p);
+	}
+
+	EXPECT_FALSE(pool.hasSpace());
+	EXPECT_THROW(pool.allocate(sizeof(double), alignof(double)), std::bad_alloc);
+
+	for (void* p : allocations)
+	{
+		pool.deallocate(p, sizeof(double), alignof(double));
+	}
+	EXPECT_TRUE(pool.hasSpace());
+
+	int x;
+	EXPECT_THROW(pool.deallocate(&x, blockData.size, blockData.align), std::invalid_argument);
+}
+
+TEST(ConcurrentBlockPoolTest, TryConstruct)
+{
+	constexpr auto blockData = allocData<double>();
+	ConcurrentBlockPool<2, blockData> pool;
+
+	double* a = pool.tryConstruct<double>(1.0);
+	double* b = pool.tryConstruct<double>(2.0);
+	ASSERT_NE(a, nullptr);
+	ASSERT_NE(b, nullptr);
+	EXPECT_EQ(*b, 2.0);
+
+	// an empty pool reports instead of throwing
+	EXPECT_EQ(pool.tryConstruct<double>(3.0), nullptr);
+
+	pool.destroy(a);
+	double* c = pool.tryConstruct<double>(4.0);
+	EXPECT_EQ(c, a);
+	pool.destroy(b);
+	pool.destroy(c);
+}
+
+TEST(ConcurrentBlockPoolTest, Magazine)
+{
+	constexpr auto blockData = allocData<uint64_t>();
+	ConcurrentBlockPool<8, blockData> pool;
+
+	std::vector<uint64_t*> allocations;
+	{
+		ConcurrentBlockPool<8, blockData>::Magazine<4> magazine(pool);
+
+		// refills take half of the magazine at once
+		allocations.push_back(magazine.construct<uint64_t>(1));
+		EXPECT_EQ(magazine.cached(), 1u);
+
+		for (uint64_t i = 2; i <= 8; ++i) {
+			allocations.push_back(magazine.construct<uint64_t>(i));
+		}
+		EXPECT_FALSE(magazine.hasSpace());
+		EXPECT_THROW(magazine.allocate(blockData.size, blockData.align), std::bad_alloc);
+
+		// a full magazine hands half of its blocks back to the pool
+		for (auto* p : allocations) {
+			magazine.destroy(p);
+		}
+		EXPECT_EQ(magazine.cached(), 4u);
+		EXPECT_TRUE(pool.hasSpace());
+	}
+
+	// everything is back in the pool after the magazine is gone
+	for (int i = 0; i < 8; ++i) {
+		EXPECT_NO_THROW(pool.allocate(blockData.size, blockData.align));
+	}
+	EXPECT_FALSE(pool.hasSpace());
+}
+
+TEST(ConcurrentBlockPoolTest, ConcurrentAllocation)
+{
+	constexpr size_t NUM_BLOCKS = 64;
+	constexpr int NUM_THREADS = 4;
+	constexpr int NUM_ITERATIONS = 10000;
+	constexpr auto blockData = allocData<uint64_t>();
+	ConcurrentBlockPool<NUM_BLOCKS, blockData> pool;
+
+	std::atomic<int> failures = 0;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < NUM_THREADS; ++t) {
+		threads.emplace_back([&pool, &failures, t]() {
+			ConcurrentBlockPool<NUM_BLOCKS, blockData>::Magazine<4> magazine(pool);
+			for (int i = 0; i < NUM_ITERATIONS; ++i) {
+				// every thread owns its blocks exclusively, a double hand out would corrupt the value
+				auto* a = (i % 2) ? pool.construct<uint64_t>(t) : magazine.construct<uint64_t>(t);
+				auto* b = pool.construct<uint64_t>(t);
+				if (*a != static_cast<uint64_t>(t) || *b != static_cast<uint64_t>(t)) failures++;
+				pool.destroy(a);
+				magazine.destroy(b);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(failures, 0);
+	for (size_t i = 0; i < NUM_BLOCKS; ++i) {
+		EXPECT_NO_THROW(pool.allocate(blockData.size, blockData.align));
+	}
+	EXPECT_FALSE(pool.hasSpace());
+}
+
 // --- StaticEntiredPool ---
 TEST(StaticEntiredPoolTest, BasicAllocationDeallocation)
 {
@@ -35,6 +35,29 @@ TEST(OSAL, currentTime)
     EXPECT_GT(ts.year, 2024);
 }
 
+TEST(OSAL, Timestamp)
+{
+    const Timestamp ts("05.03.2025 07:08:09:042");
+    EXPECT_EQ(ts.day, 5);
+    EXPECT_EQ(ts.month, 3);
+    EXPECT_EQ(ts.year, 2025);
+    EXPECT_EQ(ts.hour, 7);
+    EXPECT_EQ(ts.minute, 8);
+    EXPECT_EQ(ts.second, 9);
+    EXPECT_EQ(ts.millisecond, 42);
+
+    EXPECT_EQ(ts.dateStr(), "05.03.2025");
+    EXPECT_EQ(ts.timeStr(), "07:08:09:042");
+    EXPECT_EQ(ts.dateTimeStr(), "05.03.2025 07:08:09:042");
+
+    std::array<char, Timestamp::TIME_SIZE> buffer;
+    EXPECT_EQ(ts.formatTime(buffer.data()), buffer.data() + buffer.size());
+    EXPECT_EQ(std::string_view(buffer.data(), buffer.size()), "07:08:09:042");
+
+    EXPECT_THROW(Timestamp("05.03.2025"), std::invalid_argument);
+    EXPECT_THROW(Timestamp("05.03.2025 07:08:09:0x2"), std::invalid_argument);
+}
+
 TEST(OSAL, sleep)
 {
     const uint64_t sleep_us = 100000; // 100ms
@@ -83,7 +106,7 @@ TEST(OSAL, Mutex)
 
     for (auto& thread : threads)
     {
-        OSAL::createThread(thread, {}, [&]() {
+        OSAL::createThread(thread, "mutex", 0, {}, [&]() {
             mutex.get()->lock();
             counter++;
             mutex.get()->unlock();
@@ -105,11 +128,33 @@ TEST(OSAL, Mutex)
     EXPECT_EQ(counter, num_threads);
 }
 
+TEST(OSAL, MutexTryLock)
+{
+    OSAL::StaticImpl::Mutex mutex;
+    OSAL::createMutex(mutex);
+    ASSERT_TRUE(mutex);
+
+    ASSERT_TRUE(mutex.get()->try_lock());
+
+    std::atomic<bool> acquired = true;
+    OSAL::StaticImpl::Thread thread;
+    OSAL::createThread(thread, "trylock", 0, {}, [&]() {
+        acquired = mutex.get()->try_lock();
+    });
+    thread.get()->start();
+    thread.get()->shutdown();
+    EXPECT_FALSE(acquired);
+
+    mutex.get()->unlock();
+    std::unique_lock lock(*mutex.get(), std::try_to_lock);
+    EXPECT_TRUE(lock.owns_lock());
+}
+
 TEST(OSAL, Thread)
 {
     std::atomic<bool> executed = false;
     OSAL::StaticImpl::Thread thread;
-    OSAL::createThread(thread, {}, [&]() {
+    OSAL::createThread(thread, "thread", 0, {}, [&]() {
         executed = true;
     });
     ASSERT_TRUE(thread);
@@ -120,12 +165,57 @@ TEST(OSAL, Thread)
     EXPECT_TRUE(executed);
 }
 
+TEST(OSAL, Thread_Profile)
+{
+    std::atomic<int> cpu = -1;
+    OSAL::StaticImpl::Thread thread;
+    OSAL::createThread(thread, "profile", 0, {}, [&]() {
+#if defined(EATK_PLATFORM_LINUX)
+        cpu = sched_getcpu();
+#else
+        cpu = 0;
+#endif
+    });
+    thread.get()->setProfile({ .cpuMask = 0b1, .prefaultStack = 64 * 1024 });
+    EXPECT_EQ(thread.get()->profile().cpuMask, 0b1u);
+
+    ASSERT_TRUE(thread.get()->start());
+    thread.get()->shutdown();
+    EXPECT_EQ(cpu, 0);
+
+    // the profile is part of the static thread's type
+    using Pinned = Utils::StaticThread<OSAL::StaticImpl::CyclicThread, "pinned", 16384, 10, nullptr, 1000,
+        ThreadProfile{ .policy = SchedPolicy::Fifo, .cpuMask = 0b10, .lockMemory = true }>;
+    static_assert(Pinned::PROFILE.policy == SchedPolicy::Fifo);
+    static_assert(Utils::IsStaticThread<Pinned>);
+}
+
+TEST(OSAL, Thread_ProfilePrefaultTooLarge)
+{
+    static StaticBuffer<64 * 1024, alignof(std::max_align_t)> stack;
+    std::atomic<bool> executed = false;
+    OSAL::StaticImpl::Thread thread;
+    OSAL::createThread(thread, "prefault", 0, stack, [&]() {
+        executed = true;
+    });
+
+    // the profile is rejected instead of overflowing the stack
+    thread.get()->setProfile({ .prefaultStack = 64 * 1024 });
+    EXPECT_FALSE(thread.get()->start());
+    EXPECT_FALSE(executed);
+
+    thread.get()->setProfile({ .prefaultStack = 32 * 1024 });
+    EXPECT_TRUE(thread.get()->start());
+    thread.get()->shutdown();
+    EXPECT_TRUE(executed);
+}
+
 TEST(OSAL, CyclicThread)
 {
     std::atomic<int> counter = 0;
     OSAL::StaticImpl::CyclicThread cyclicThread;
     std::array<std::byte, 16384> stack;
-    OSAL::createCyclicThread(cyclicThread, stack, [&]() {
+    OSAL::createCyclicThread(cyclicThread, "cyclic", 0, stack, [&]() {
         counter++;
     });
     ASSERT_TRUE(cyclicThread);
@@ -145,25 +235,481 @@ TEST(OSAL, CyclicThread)
     EXPECT_LE(counter, 6);
 }
 
+TEST(OSAL, CycleStatistic)
+{
+    CycleStatistic stat;
+    for (uint64_t value : {0ull, 1ull, 3ull, 100ull, 100ull, 1000ull, 10000000000ull}) {
+        stat.record(value);
+    }
+
+    auto snapshot = stat.snapshot();
+    EXPECT_EQ(snapshot.count, 7u);
+    EXPECT_EQ(snapshot.min, 0u);
+    EXPECT_EQ(snapshot.max, std::numeric_limits<uint32_t>::max());
+    EXPECT_EQ(snapshot.sum, 1204ull + std::numeric_limits<uint32_t>::max());
+    EXPECT_EQ(snapshot.histogram[0], 1u);
+    EXPECT_EQ(snapshot.histogram[CycleStatistic::bucket(3)], 1u);
+    EXPECT_EQ(snapshot.histogram[CycleStatistic::bucket(100)], 2u);
+    EXPECT_EQ(snapshot.histogram[CycleStatistic::BUCKETS - 1], 1u);
+    EXPECT_EQ(snapshot.percentile(0.5), 127u);
+    EXPECT_EQ(snapshot.percentile(1.0), snapshot.max);
+
+    stat.reset();
+    snapshot = stat.snapshot();
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.mean(), 0.0);
+    stat.record(5);
+    EXPECT_EQ(stat.snapshot().min, 5u);
+}
+
+TEST(OSAL, SplitCounter)
+{
+    SequenceLock lock;
+    SplitCounter counter;
+
+    // carries into the high word instead of wrapping after 2^32
+    lock.beginWrite();
+    counter.store(std::numeric_limits<uint32_t>::max());
+    counter.add(1);
+    lock.endWrite();
+
+    uint64_t value = 0;
+    lock.read([&]() { value = counter.load(); });
+    EXPECT_EQ(value, uint64_t{1} << 32);
+
+    lock.beginWrite();
+    counter.add(uint64_t{5} << 32);
+    lock.endWrite();
+    lock.read([&]() { value = counter.load(); });
+    EXPECT_EQ(value, uint64_t{6} << 32);
+}
+
+TEST(OSAL, CyclicThread_Statistics)
+{
+    std::atomic<int> counter = 0;
+    OSAL::StaticImpl::CyclicThread cyclicThread;
+    OSAL::createCyclicThread(cyclicThread, "stats", 0, {}, [&]() {
+        counter++;
+        OSAL::sleep(1000);
+    });
+
+    cyclicThread.get()->start(5000); // 5ms cycle
+    OSAL::sleep(52000);
+
+    // read while the thread keeps running
+    const auto stats = cyclicThread.get()->statistics();
+    EXPECT_GE(stats.cycles, 9u);
+    EXPECT_EQ(stats.latency.count, stats.cycles);
+    EXPECT_EQ(stats.execution.count, stats.cycles);
+    EXPECT_GE(stats.execution.min, 1'000'000u);
+    EXPECT_LT(stats.execution.mean(), 5000000);
+    EXPECT_EQ(stats.overruns, 0u);
+
+    cyclicThread.get()->resetStatistics();
+    OSAL::sleep(12000);
+    EXPECT_LE(cyclicThread.get()->statistics().cycles, 4u);
+
+    cyclicThread.get()->shutdown();
+}
+
+namespace {
+    // feeds the cycle bookkeeping with synthetic times instead of running a thread
+    class ManualCyclicThread : public OSAL::CyclicThread
+    {
+    public:
+        bool start(uint64_t) override { return true; }
+        void shutdown() override {}
+        bool setPriority(int, int) override { return true; }
+        bool isRunning() const override { return false; }
+
+        // every cycle starts when it is due or when the previous one ended, whichever is later
+        void run(const size_t cycles, const uint64_t period_ns, const uint64_t execution_ns)
+        {
+            uint64_t due_ns = 0;
+            uint64_t end_ns = 0;
+            for (size_t i = 0; i < cycles; ++i) {
+                const uint64_t start_ns = std::max(due_ns, end_ns);
+                end_ns = start_ns + execution_ns;
+                due_ns = completeCycle(due_ns, start_ns, end_ns, period_ns);
+            }
+        }
+    };
+}
+
+TEST(OSAL, CyclicThread_OverrunPolicy)
+{
+    // every cycle takes two and a half periods
+    const auto simulate = [](OverrunPolicy policy) {
+        ManualCyclicThread cyclicThread;
+        cyclicThread.setOverrunPolicy(policy);
+        cyclicThread.run(6, 2'000'000, 5'000'000);
+        return cyclicThread.statistics();
+    };
+
+    // every cycle starts three periods later than the one before
+    const auto catchUp = simulate(OverrunPolicy::CatchUp);
+    EXPECT_EQ(catchUp.cycles, 6u);
+    EXPECT_EQ(catchUp.overruns, 6u);
+    EXPECT_EQ(catchUp.skipped, 0u);
+    EXPECT_EQ(catchUp.latency.max, 15'000'000u);
+
+    // the next cycle waits for the grid, two periods are dropped each time
+    const auto skip = simulate(OverrunPolicy::Skip);
+    EXPECT_EQ(skip.overruns, 6u);
+    EXPECT_EQ(skip.skipped, 12u);
+    EXPECT_EQ(skip.latency.max, 0u);
+
+    const auto rephase = simulate(OverrunPolicy::Rephase);
+    EXPECT_EQ(rephase.overruns, 6u);
+    EXPECT_EQ(rephase.skipped, 0u);
+    EXPECT_EQ(rephase.latency.max, 0u);
+}
+
+TEST(OSAL, CyclicThread_OverrunPolicyThread)
+{
+    // the task never takes less than two and a half periods, only what that implies is checked
+    const auto run = [](OverrunPolicy policy) {
+        OSAL::StaticImpl::CyclicThread cyclicThread;
+        OSAL::createCyclicThread(cyclicThread, "overrun", 0, {}, []() {
+            OSAL::sleep(5000);
+        });
+        cyclicThread.get()->setOverrunPolicy(policy);
+        cyclicThread.get()->start(2000);
+        OSAL::sleep(31000);
+        cyclicThread.get()->shutdown();
+        return cyclicThread.get()->statistics();
+    };
+
+    const auto catchUp = run(OverrunPolicy::CatchUp);
+    EXPECT_GE(catchUp.cycles, 1u);
+    EXPECT_EQ(catchUp.overruns, catchUp.cycles);
+    EXPECT_EQ(catchUp.skipped, 0u);
+    EXPECT_GE(catchUp.latency.max, (catchUp.cycles - 1) * 3'000'000u);
+
+    const auto skip = run(OverrunPolicy::Skip);
+    EXPECT_GE(skip.cycles, 1u);
+    EXPECT_EQ(skip.overruns, skip.cycles);
+    EXPECT_GE(skip.skipped, 2 * skip.cycles);
+
+    const auto rephase = run(OverrunPolicy::Rephase);
+    EXPECT_GE(rephase.cycles, 1u);
+    EXPECT_EQ(rephase.overruns, rephase.cycles);
+    EXPECT_EQ(rephase.skipped, 0u);
+}
+
+namespace {
+    std::vector<int> g_executorTrace;
+    std::atomic<int> g_executorTicks = 0;
+
+    void executorFast() { g_executorTrace.push_back(1); g_executorTicks++; }
+    void executorMedium() { g_executorTrace.push_back(2); }
+    void executorSlow() { g_executorTrace.push_back(4); OSAL::sleep(2000); }
+}
+
+TEST(Utils, CyclicExecutor)
+{
+    using Executor = Utils::CyclicExecutor<OSAL::StaticImpl::CyclicThread, "executor", 65536, 0, 5000, Utils::CyclicTasks<
+        Utils::CyclicTask<&executorSlow, 4, 1, 1000>,
+        Utils::CyclicTask<&executorMedium, 2, 0, 1000>,
+        Utils::CyclicTask<&executorFast, 1>>>;
+
+    static_assert(Executor::HYPERPERIOD == 4);
+    static_assert(Executor::ORDER == std::array<size_t, 3>{ 2, 1, 0 });
+    static_assert(Executor::WORST_TICK_BUDGET_US == 1000);
+
+    // without budgets nothing has to be walked, however long the hyperperiod is
+    using Unbudgeted = Utils::CyclicExecutor<OSAL::StaticImpl::CyclicThread, "unbudgeted", 65536, 0, 5000, Utils::CyclicTasks<
+        Utils::CyclicTask<&executorFast, 65521>,
+        Utils::CyclicTask<&executorMedium, 65519>>>;
+    static_assert(Unbudgeted::HYPERPERIOD > Unbudgeted::MAX_CHECKED_HYPERPERIOD);
+    static_assert(Unbudgeted::WORST_TICK_BUDGET_US == 0);
+
+    g_executorTrace.clear();
+    g_executorTicks = 0;
+    auto executor = std::make_unique<Executor>();
+    ASSERT_TRUE(executor->start());
+    while (g_executorTicks < 8) {
+        OSAL::sleep(1000);
+    }
+    executor->shutdown();
+
+    // rate monotonic within a tick, the slow task runs between the medium ones
+    const std::vector<int> expected{ 1, 2,  1, 4,  1, 2,  1,  1, 2,  1, 4,  1, 2,  1 };
+    ASSERT_GE(g_executorTrace.size(), expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), g_executorTrace.begin()));
+
+    const auto slow = executor->taskStatistics(0);
+    EXPECT_EQ(slow.execution.count, 2u);
+    EXPECT_EQ(slow.budgetOverruns, 2u);
+    EXPECT_GE(slow.execution.min, 2'000'000u);
+    EXPECT_EQ(executor->taskStatistics(1).budgetOverruns, 0u);
+    EXPECT_EQ(executor->statistics().cycles, executor->taskStatistics(2).execution.count);
+}
+
+TEST(Utils, ThreadPool_Submit)
+{
+    auto pool = std::make_unique<Utils::ThreadPool<3, 16>>();
+
+    // queued before the workers run, the waiting thread helps
+    std::atomic_int sum = 0;
+    auto early = pool->submit([&sum]() { sum += 1; });
+    EXPECT_TRUE(early.valid());
+    early.wait();
+    EXPECT_TRUE(early.ready());
+    EXPECT_EQ(sum, 1);
+
+    ASSERT_TRUE(pool->start());
+    std::vector<decltype(pool)::element_type::Future> futures;
+    for (int i = 0; i < 200; ++i) {
+        futures.push_back(pool->submit([&sum]() { sum += 2; }));
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+    EXPECT_EQ(sum, 401);
+
+    // fire and forget, shutdown finishes queued work
+    for (int i = 0; i < 100; ++i) {
+        pool->submit([&sum]() { sum += 1; });
+    }
+    pool->shutdown();
+    EXPECT_EQ(sum, 501);
+
+    decltype(pool)::element_type::Future empty;
+    EXPECT_FALSE(empty.valid());
+    EXPECT_THROW(empty.wait(), std::logic_error);
+}
+
+TEST(Utils, ThreadPool_ParallelFor)
+{
+    auto pool = std::make_unique<Utils::ThreadPool<4, 8>>();
+    ASSERT_TRUE(pool->start());
+
+    std::vector<std::atomic_uint8_t> visited(100000);
+    pool->parallelFor(0, visited.size(), [&visited](size_t i) { visited[i].fetch_add(1, std::memory_order_relaxed); }, 16);
+    EXPECT_TRUE(std::ranges::all_of(visited, [](const std::atomic_uint8_t& count) { return count.load() == 1; }));
+
+    // nested in submitted tasks, ranges are split on the worker deques
+    std::atomic_size_t total = 0;
+    std::array<decltype(pool)::element_type::Future, 4> futures;
+    for (auto& future : futures) {
+        future = pool->submit([&pool, &total]() {
+            pool->parallelFor(10, 1010, [&total](size_t i) { total.fetch_add(i, std::memory_order_relaxed); });
+        });
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+    EXPECT_EQ(total, size_t{4} * (1009 * 1010 / 2 - 9 * 10 / 2));
+
+    pool->parallelFor(5, 5, [](size_t) { FAIL(); });
+    pool->shutdown();
+}
+
+TEST(Utils, TimerWheel)
+{
+    // small wheel so timers cascade across levels and beyond the range of the wheel
+    using Wheel = Utils::StaticTimerWheel<2, 3>;
+    static_assert(Wheel::MAX_TICKS == 63);
+
+    struct Probe
+    {
+        Utils::WheelTimer timer;
+        uint64_t expected = 0;
+        std::vector<uint64_t> fired;
+    };
+
+    auto wheel = std::make_unique<Wheel>();
+    std::array<Probe, 200> probes;
+    for (size_t i = 0; i < probes.size(); ++i) {
+        probes[i].timer.setCallback([](Utils::WheelTimer& timer, Utils::ITimerWheel& wheel) {
+            static_cast<Probe*>(timer.context())->fired.push_back(wheel.now());
+        }, &probes[i]);
+        const uint64_t ticks = 1 + (i * 37) % 150;
+        probes[i].expected = ticks;
+        wheel->arm(probes[i].timer, ticks);
+    }
+    EXPECT_EQ(wheel->size(), probes.size());
+
+    // every fifth timer cancelled, every seventh moved by re-arming
+    for (size_t i = 0; i < probes.size(); i += 5) {
+        EXPECT_TRUE(wheel->cancel(probes[i].timer));
+        EXPECT_FALSE(wheel->cancel(probes[i].timer));
+        probes[i].expected = 0;
+    }
+    wheel->advance(3);
+    for (size_t i = 1; i < probes.size(); i += 7) {
+        if (probes[i].expected <= 3) continue;
+        wheel->arm(probes[i].timer, 100);
+        probes[i].expected = 103;
+    }
+
+    // uneven steps, including one across the whole wheel
+    for (const uint64_t step : { 1, 2, 13, 70, 1, 5, 200 }) {
+        wheel->advance(step);
+    }
+    EXPECT_EQ(wheel->size(), 0u);
+    for (const auto& probe : probes) {
+        if (probe.expected == 0) {
+            EXPECT_TRUE(probe.fired.empty());
+        }
+        else {
+            ASSERT_EQ(probe.fired.size(), 1u);
+            EXPECT_EQ(probe.fired[0], probe.expected);
+        }
+        EXPECT_FALSE(probe.timer.isArmed());
+    }
+
+    // periodic timer, cancelled by its own callback after the third expiry
+    Probe periodic;
+    periodic.timer.setCallback([](Utils::WheelTimer& timer, Utils::ITimerWheel& wheel) {
+        auto& probe = *static_cast<Probe*>(timer.context());
+        probe.fired.push_back(wheel.now());
+        if (probe.fired.size() == 3) wheel.cancel(timer);
+    }, &periodic);
+    const uint64_t start = wheel->now();
+    wheel->arm(periodic.timer, 2, 5);
+    EXPECT_EQ(wheel->advance(30), 3u);
+    EXPECT_EQ(periodic.fired, (std::vector<uint64_t>{ start + 2, start + 7, start + 12 }));
+
+    // timers without callback go to the expired handler, destroyed timers are unlinked
+    {
+        Utils::WheelTimer dangling;
+        wheel->arm(dangling, 10);
+    }
+    Utils::WheelTimer event;
+    wheel->arm(event, 4);
+    std::vector<Utils::WheelTimer*> expired;
+    wheel->advance(20, [&expired](Utils::WheelTimer& timer) { expired.push_back(&timer); });
+    EXPECT_EQ(expired, (std::vector<Utils::WheelTimer*>{ &event }));
+}
+
+TEST(Utils, TimerWheel_SingleLevel)
+{
+    // timers further away than one turn are parked in a slot that comes up before they are due
+    using Wheel = Utils::StaticTimerWheel<6, 1>;
+    static_assert(Wheel::MAX_TICKS == 63);
+
+    auto wheel = std::make_unique<Wheel>();
+    Utils::WheelTimer far, near, farther;
+    wheel->arm(far, 100);
+    wheel->arm(near, 64);
+    wheel->arm(farther, 200);
+
+    // the parked timer in front of the due one must not hold it back
+    std::vector<std::pair<Utils::WheelTimer*, uint64_t>> expired;
+    const auto collect = [&expired, &wheel](Utils::WheelTimer& timer) { expired.emplace_back(&timer, wheel->now()); };
+    wheel->advance(63, collect);
+    EXPECT_TRUE(expired.empty());
+    wheel->advance(1, collect);
+    wheel->advance(200, collect);
+
+    const std::vector<std::pair<Utils::WheelTimer*, uint64_t>> expected{ { &near, 64 }, { &far, 100 }, { &farther, 200 } };
+    EXPECT_EQ(expired, expected);
+    EXPECT_EQ(wheel->size(), 0u);
+}
+
+TEST(Utils, TimerWheel_CallbackCancelsDue)
+{
+    // both timers are due on the same tick, the first one cancels the second
+    auto wheel = std::make_unique<Utils::StaticTimerWheel<2, 2>>();
+    Utils::WheelTimer second;
+    Utils::WheelTimer first([](Utils::WheelTimer& timer, Utils::ITimerWheel& wheel) {
+        EXPECT_TRUE(wheel.cancel(*static_cast<Utils::WheelTimer*>(timer.context())));
+    }, &second);
+
+    wheel->arm(first, 5);
+    wheel->arm(second, 5);
+    std::vector<Utils::WheelTimer*> expired;
+    EXPECT_EQ(wheel->advance(10, [&expired](Utils::WheelTimer& timer) { expired.push_back(&timer); }), 1u);
+    EXPECT_TRUE(expired.empty());
+    EXPECT_FALSE(second.isArmed());
+    EXPECT_EQ(wheel->size(), 0u);
+}
+
+TEST(Utils, TimerService)
+{
+    auto service = std::make_unique<Utils::TimerService<1000, 4>>();
+    static_assert(Utils::TimerService<1000>::toTicks(1) == 1);
+    static_assert(Utils::TimerService<1000>::toTicks(2000) == 2);
+
+    std::atomic_int callbacks = 0;
+    Utils::WheelTimer callback([](Utils::WheelTimer& timer, Utils::ITimerWheel&) {
+        static_cast<std::atomic_int*>(timer.context())->fetch_add(1);
+    }, &callbacks);
+    Utils::WheelTimer event;
+    Utils::WheelTimer cancelled;
+
+    service->tick();
+    const uint64_t start = OSAL::monotonicTime();
+    service->arm(callback, 3000);
+    service->arm(event, 5000);
+    service->arm(cancelled, 4000);
+    EXPECT_EQ(service->size(), 3u);
+    EXPECT_TRUE(service->cancel(cancelled));
+
+    while (service->size() > 0) {
+        service->tick();
+        OSAL::sleep(500);
+    }
+    EXPECT_GE(OSAL::monotonicTime() - start, 5000u);
+    EXPECT_EQ(callbacks, 1);
+    EXPECT_EQ(service->pollExpired(), &event);
+    EXPECT_FALSE(service->pollExpired().has_value());
+    EXPECT_EQ(service->droppedEvents(), 0u);
+}
+
+TEST(Utils, TimerService_DestroyArmed)
+{
+    // timers destroyed while armed unlink themselves under the service lock, while it ticks
+    auto service = std::make_unique<Utils::TimerService<100, 64>>();
+    std::atomic_bool running = true;
+    OSAL::StaticImpl::Thread ticker;
+    OSAL::createThread(ticker, "ticker", 0, {}, [&]() {
+        while (running) {
+            service->tick();
+            while (service->pollExpired()) {}
+        }
+    });
+    ticker.get()->start();
+
+    std::atomic_int callbacks = 0;
+    for (int i = 0; i < 2000; ++i) {
+        Utils::WheelTimer oneShot([](Utils::WheelTimer& timer, Utils::ITimerWheel&) {
+            static_cast<std::atomic_int*>(timer.context())->fetch_add(1);
+        }, &callbacks);
+        Utils::WheelTimer periodic([](Utils::WheelTimer&, Utils::ITimerWheel&) {});
+        service->arm(oneShot, i % 300);
+        service->arm(periodic, 100, 100);
+        if (i % 10 == 0) OSAL::sleep(200);
+    }
+
+    running = false;
+    ticker.get()->shutdown();
+    EXPECT_EQ(service->size(), 0u);
+}
+
 TEST(OSAL, MessageQueue_PushPop)
 {
     constexpr size_t QUEUE_SIZE = 16;
-    StaticObjectStore<SboAny, QUEUE_SIZE> store;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticBlockPool<QUEUE_SIZE, allocData<MsgType>()> pool;
+    StaticObjectStore<MsgType*, QUEUE_SIZE> store;
     OSAL::StaticImpl::MessageQueue queue;
-    OSAL::createMessageQueue(queue, store);
+    OSAL::createMessageQueue(queue, store, pool);
     ASSERT_TRUE(queue);
 
     EXPECT_TRUE(queue.get()->empty());
 
     // Push a value
     int test_val = 42;
-    EXPECT_TRUE(queue.get()->push(SboAny(std::in_place_type<int>, test_val)));
+    EXPECT_TRUE(queue.get()->push(MsgType(std::in_place_type<int>, test_val)));
     EXPECT_FALSE(queue.get()->empty());
 
     // Pop the value
     auto result = queue.get()->pop();
     ASSERT_TRUE(result.has_value());
-    int popped_val = result->as<int>();
+    int popped_val = result->asUnchecked<int>();
     EXPECT_EQ(popped_val, test_val);
     EXPECT_TRUE(queue.get()->empty());
 }
@@ -171,9 +717,11 @@ TEST(OSAL, MessageQueue_PushPop)
 TEST(OSAL, MessageQueue_TryPop)
 {
     constexpr size_t QUEUE_SIZE = 16;
-    StaticObjectStore<SboAny, QUEUE_SIZE> store;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticBlockPool<QUEUE_SIZE, allocData<MsgType>()> pool;
+    StaticObjectStore<MsgType*, QUEUE_SIZE> store;
     OSAL::StaticImpl::MessageQueue queue;
-    OSAL::createMessageQueue(queue, store);
+    OSAL::createMessageQueue(queue, store, pool);
     ASSERT_TRUE(queue);
 
     // TryPop on empty queue
@@ -182,12 +730,12 @@ TEST(OSAL, MessageQueue_TryPop)
 
     // Push a value
     double test_val = 123.345;
-    queue.get()->push(SboAny(std::in_place_type<double>, test_val));
+    queue.get()->push(MsgType(std::in_place_type<double>, test_val));
 
     // TryPop on non-empty queue
     result = queue.get()->tryPop();
     ASSERT_TRUE(result.has_value());
-    double popped_val = result->as<double>();
+    double popped_val = result->asUnchecked<double>();
     EXPECT_EQ(popped_val, test_val);
     EXPECT_TRUE(queue.get()->empty());
 }
@@ -195,9 +743,11 @@ TEST(OSAL, MessageQueue_TryPop)
 TEST(OSAL, MessageQueue_BlockingPop)
 {
     constexpr size_t QUEUE_SIZE = 16;
-    StaticObjectStore<SboAny, QUEUE_SIZE> store;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticBlockPool<QUEUE_SIZE, allocData<MsgType>()> pool;
+    StaticObjectStore<MsgType*, QUEUE_SIZE> store;
     OSAL::StaticImpl::MessageQueue queue;
-    OSAL::createMessageQueue(queue, store);
+    OSAL::createMessageQueue(queue, store, pool);
     ASSERT_TRUE(queue);
 
     std::atomic<bool> popped = false;
@@ -205,9 +755,9 @@ TEST(OSAL, MessageQueue_BlockingPop)
     int popped_val = 0;
 
     OSAL::StaticImpl::Thread popThread;
-    OSAL::createThread(popThread, {}, [&]() {
+    OSAL::createThread(popThread, "pop", 0, {}, [&]() {
         auto result = queue.get()->pop(); // This should block
-        popped_val = result->as<int>();
+        popped_val = result->asUnchecked<int>();
         popped = true;
     });
 
@@ -218,7 +768,7 @@ TEST(OSAL, MessageQueue_BlockingPop)
     EXPECT_FALSE(popped);
 
     // Push a value to unblock the other thread
-    queue.get()->push(SboAny(std::in_place_type<int>, test_val));
+    queue.get()->push(MsgType(std::in_place_type<int>, test_val));
 
     // Wait for the pop thread to finish
     popThread.get()->shutdown();
@@ -231,16 +781,17 @@ TEST(OSAL, MessageQueue_PushManyPopAvail)
 {
     constexpr size_t QUEUE_SIZE = 16;
     constexpr size_t NUM_MSGS = 5;
-    StaticObjectStore<SboAny, QUEUE_SIZE> store;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticBlockPool<QUEUE_SIZE, allocData<MsgType>()> pool;
+    StaticObjectStore<MsgType*, QUEUE_SIZE> store;
     OSAL::StaticImpl::MessageQueue queue;
-    OSAL::createMessageQueue(queue, store);
+    OSAL::createMessageQueue(queue, store, pool);
     ASSERT_TRUE(queue);
 
     // Prepare messages to push
-    StaticObjectStore<SboAny, NUM_MSGS> pushStore;
-    StaticQueueView<SboAny> pushQueue(pushStore);
+    StaticQueue<MsgType, NUM_MSGS> pushQueue;
     for(size_t i = 0; i < NUM_MSGS; ++i) {
-        pushQueue.push(SboAny(std::in_place_type<int>, static_cast<int>(i)));
+        pushQueue.push(MsgType(std::in_place_type<int>, static_cast<int>(i)));
     }
 
     // Push many
@@ -248,15 +799,238 @@ TEST(OSAL, MessageQueue_PushManyPopAvail)
     EXPECT_TRUE(pushQueue.empty()); // pushMany should move the items
 
     // Pop avail
-    StaticObjectStore<SboAny, QUEUE_SIZE> popStore;
-    StaticQueueView<SboAny> popQueue(popStore);
+    StaticQueue<MsgType, QUEUE_SIZE> popQueue;
     EXPECT_TRUE(queue.get()->popAvail(popQueue));
     EXPECT_TRUE(queue.get()->empty());
     EXPECT_EQ(popQueue.size(), NUM_MSGS);
 
     // Verify popped messages
     for(size_t i = 0; i < NUM_MSGS; ++i) {
-        auto val = popQueue[i].as<int>();
+        auto val = popQueue[i].asUnchecked<int>();
         EXPECT_EQ(val, i);
     }
-}
\ No newline at end of file
+}
+TEST(OSAL, MessageQueue_LockFreePushPop)
+{
+    constexpr size_t QUEUE_SIZE = 4;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticObjectStore<OSAL::MessageQueue::SlotType, QUEUE_SIZE> store;
+    OSAL::StaticImpl::MessageQueue queue;
+    OSAL::createMessageQueue(queue, store, QueueProducers::Single);
+    ASSERT_TRUE(queue);
+
+    EXPECT_TRUE(queue.get()->empty());
+    EXPECT_FALSE(queue.get()->tryPop().has_value());
+
+    for (int i = 0; i < static_cast<int>(QUEUE_SIZE); ++i) {
+        EXPECT_TRUE(queue.get()->push(MsgType(std::in_place_type<int>, i)));
+    }
+    EXPECT_FALSE(queue.get()->push(MsgType(std::in_place_type<int>, 99))); // full
+
+    for (int i = 0; i < static_cast<int>(QUEUE_SIZE); ++i) {
+        auto result = queue.get()->pop();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->asUnchecked<int>(), i);
+    }
+    EXPECT_TRUE(queue.get()->empty());
+
+    // wraps around the ring
+    EXPECT_TRUE(queue.get()->push(MsgType(std::in_place_type<int>, 42)));
+    auto result = queue.get()->tryPop();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->asUnchecked<int>(), 42);
+}
+
+TEST(OSAL, MessageQueue_LockFreePopAvailFull)
+{
+    constexpr size_t QUEUE_SIZE = 4;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticObjectStore<OSAL::MessageQueue::SlotType, QUEUE_SIZE> store;
+    OSAL::StaticImpl::MessageQueue queue;
+    OSAL::createMessageQueue(queue, store, QueueProducers::Single);
+
+    EXPECT_TRUE(queue.get()->push(MsgType(std::in_place_type<int>, 1)));
+
+    // a full destination returns instead of waiting for space that never comes
+    StaticQueue<MsgType, 1> data;
+    data.push(MsgType(std::in_place_type<int>, 0));
+    EXPECT_FALSE(queue.get()->popAvail(data));
+    EXPECT_FALSE(queue.get()->empty());
+
+    data.clear();
+    EXPECT_TRUE(queue.get()->popAvail(data));
+    EXPECT_EQ(data[0].asUnchecked<int>(), 1);
+}
+
+TEST(OSAL, MessageQueue_LockFreeBlockingPop)
+{
+    constexpr size_t QUEUE_SIZE = 16;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticObjectStore<OSAL::MessageQueue::SlotType, QUEUE_SIZE> store;
+    OSAL::StaticImpl::MessageQueue queue;
+    OSAL::createMessageQueue(queue, store, QueueProducers::Single);
+    ASSERT_TRUE(queue);
+
+    std::atomic<bool> popped = false;
+    int popped_val = 0;
+
+    OSAL::StaticImpl::Thread popThread;
+    OSAL::createThread(popThread, "pop", 0, {}, [&]() {
+        auto result = queue.get()->pop(); // This should block
+        popped_val = result->asUnchecked<int>();
+        popped = true;
+    });
+    popThread.get()->start();
+
+    OSAL::sleep(20000); // 20ms
+    EXPECT_FALSE(popped);
+
+    queue.get()->push(MsgType(std::in_place_type<int>, 123));
+    popThread.get()->shutdown();
+
+    EXPECT_TRUE(popped);
+    EXPECT_EQ(popped_val, 123);
+}
+
+TEST(OSAL, MessageQueue_LockFreeMultiProducer)
+{
+    constexpr size_t QUEUE_SIZE = 64;
+    constexpr int NUM_PRODUCERS = 4;
+    constexpr int NUM_MSGS = 1000;
+    using MsgType = OSAL::MessageQueue::MsgType;
+    StaticObjectStore<OSAL::MessageQueue::SlotType, QUEUE_SIZE> store;
+    OSAL::StaticImpl::MessageQueue queue;
+    OSAL::createMessageQueue(queue, store, QueueProducers::Multi);
+    ASSERT_TRUE(queue);
+
+    std::array<OSAL::StaticImpl::Thread, NUM_PRODUCERS> producers;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        OSAL::createThread(producers[p], "producer", 0, {}, [&queue, p]() {
+            for (int i = 0; i < NUM_MSGS; ++i) {
+                while (!queue.get()->push(MsgType(std::in_place_type<int>, p*NUM_MSGS + i))) {
+                    OSAL::sleep(10);
+                }
+            }
+        });
+        producers[p].get()->start();
+    }
+
+    // messages of one producer must arrive in order
+    std::array<int, NUM_PRODUCERS> last;
+    last.fill(-1);
+    StaticQueue<MsgType, 16> batch;
+    int received = 0;
+    while (received < NUM_PRODUCERS*NUM_MSGS) {
+        ASSERT_TRUE(queue.get()->popAvail(batch));
+        for (auto& msg : batch) {
+            const int val = msg.asUnchecked<int>();
+            const int p = val / NUM_MSGS;
+            EXPECT_GT(val % NUM_MSGS, last[p]);
+            last[p] = val % NUM_MSGS;
+            ++received;
+        }
+        batch.clear();
+    }
+
+    for (auto& producer : producers) {
+        producer.get()->shutdown();
+    }
+    EXPECT_TRUE(queue.get()->empty());
+}
+
+TEST(OSAL, MessageQueue_TypedPushPop)
+{
+    Utils::StaticTypedMessageQueue<std::string, 4, QueueProducers::Single> queue;
+    Utils::setupStaticMessageQueue(queue);
+
+    EXPECT_FALSE(Utils::tryPopStaticMessageQueue<std::string>(queue).has_value());
+
+    EXPECT_TRUE(Utils::pushStaticMessageQueue(queue, std::string("first")));
+    const std::string second = "second";
+    EXPECT_TRUE(Utils::pushStaticMessageQueue(queue, second));
+    EXPECT_TRUE(Utils::emplaceStaticMessageQueue<std::string>(queue, 5, 'x'));
+
+    StaticQueue<std::string, 2> data{"a", "b"};
+    EXPECT_FALSE(Utils::pushManyStaticMessageQueue(queue, std::move(data))); // only one slot left
+
+    auto result = Utils::popStaticMessageQueue<std::string>(queue);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, "first");
+
+    StaticQueue<std::string, 8> popQueue;
+    EXPECT_TRUE(Utils::popAvailStaticMessageQueue(queue, popQueue));
+    ASSERT_EQ(popQueue.size(), 2u);
+    EXPECT_EQ(popQueue[0], "second");
+    EXPECT_EQ(popQueue[1], "xxxxx");
+
+    // nothing popped, the last batch stays
+    EXPECT_FALSE(Utils::tryPopAvailStaticMessageQueue(queue, popQueue));
+    ASSERT_EQ(popQueue.size(), 2u);
+    EXPECT_EQ(popQueue[1], "xxxxx");
+}
+
+TEST(OSAL, MessageQueue_TypedBlockingPop)
+{
+    Utils::StaticTypedMessageQueue<int, 16> queue;
+    Utils::setupStaticMessageQueue(queue);
+
+    std::atomic<bool> popped = false;
+    StaticQueue<int, 16> popQueue;
+
+    OSAL::StaticImpl::Thread popThread;
+    OSAL::createThread(popThread, "pop", 0, {}, [&]() {
+        Utils::popAvailStaticMessageQueue(queue, popQueue); // This should block
+        popped = true;
+    });
+    popThread.get()->start();
+
+    OSAL::sleep(20000); // 20ms
+    EXPECT_FALSE(popped);
+
+    Utils::pushStaticMessageQueue(queue, 7);
+    popThread.get()->shutdown();
+
+    EXPECT_TRUE(popped);
+    ASSERT_EQ(popQueue.size(), 1u);
+    EXPECT_EQ(popQueue[0], 7);
+}
+
+TEST(OSAL, MessageQueue_TypedDrainView)
+{
+    Utils::StaticTypedMessageQueue<std::string, 4, QueueProducers::Single> queue;
+    Utils::setupStaticMessageQueue(queue);
+
+    EXPECT_TRUE(queue.queue.drain().empty());
+
+    // move head and tail forward so that the drained range wraps around the ring
+    for (const char* s : {"a", "b", "c"}) {
+        Utils::pushStaticMessageQueue(queue, std::string(s));
+    }
+    EXPECT_TRUE(Utils::tryPopStaticMessageQueue<std::string>(queue).has_value());
+    EXPECT_TRUE(Utils::tryPopStaticMessageQueue<std::string>(queue).has_value());
+    for (const char* s : {"d", "e", "f"}) {
+        Utils::pushStaticMessageQueue(queue, std::string(s));
+    }
+
+    {
+        const auto view = queue.queue.drain(3);
+        ASSERT_EQ(view.size(), 3u);
+
+        const auto segments = view.segments();
+        EXPECT_EQ(segments[0].size(), 2u);
+        EXPECT_EQ(segments[1].size(), 1u);
+        EXPECT_EQ(*segments[1][0].value(), "e");
+
+        std::string joined;
+        for (const auto& s : view) joined += s;
+        EXPECT_EQ(joined, "cde");
+
+        // nothing is released while the view is alive
+        EXPECT_FALSE(Utils::pushStaticMessageQueue(queue, std::string("x")));
+    }
+
+    auto last = Utils::tryPopStaticMessageQueue<std::string>(queue);
+    ASSERT_TRUE(last.has_value());
+    EXPECT_EQ(*last, "f");
+    EXPECT_TRUE(queue.queue.empty());
+}